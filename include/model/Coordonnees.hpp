@@ -0,0 +1,90 @@
+#ifndef COORDONNEES_HPP
+#define COORDONNEES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/************************************************************
+ * Classe Coordonnees
+ * Cases d'une pièce, relatives à sa position
+ *
+ * Jusqu'à CAPACITE_INTERNE cases sont stockées dans l'objet lui-même :
+ * la première case (origine) en entiers, puis l'écart de chaque case à
+ * cette origine sur un octet. Les pièces plus grandes, ou plus étendues
+ * qu'un octet ne le permet, débordent dans un vecteur.
+ *
+ * Copier, comparer ou transformer les coordonnées d'une petite pièce
+ * n'alloue donc rien, et une translation ne déplace que l'origine.
+ *
+ * Se parcourt comme un conteneur de pair<int, int> (par valeur).
+ ************************************************************/
+class Coordonnees {
+public:
+    static const size_t CAPACITE_INTERNE = 8;
+
+    // Les cases sont reconstruites à la lecture : l'itérateur rend des valeurs, pas des
+    // références, et n'est donc qu'un itérateur d'entrée au sens de la bibliothèque standard
+    class const_iterator {
+    public:
+        typedef input_iterator_tag iterator_category;
+        typedef pair<int, int> value_type;
+        typedef ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef pair<int, int> reference;
+
+        const_iterator(const Coordonnees* coordonnees, size_t index) : coordonnees(coordonnees), index(index) {}
+        pair<int, int> operator*() const { return (*coordonnees)[index]; }
+        const_iterator& operator++() { ++index; return *this; }
+        const_iterator operator++(int) { const_iterator copie(*this); ++index; return copie; }
+        bool operator==(const const_iterator& autre) const { return index == autre.index; }
+        bool operator!=(const const_iterator& autre) const { return index != autre.index; }
+
+    private:
+        const Coordonnees* coordonnees;
+        size_t index;
+    };
+
+    Coordonnees() : origineX(0), origineY(0), taille(0), externe(false) {}
+    Coordonnees(const vector<pair<int, int>>& cases);  // Conversion depuis un Niveau ou une liste
+
+    size_t size() const { return taille; }
+    bool empty() const { return taille == 0; }
+    bool estInterne() const { return !externe; }  // Aucune allocation derrière ces coordonnées
+
+    pair<int, int> operator[](size_t index) const {
+        if (externe) {
+            return debordement[index];
+        }
+        return make_pair(origineX + ecarts[2 * index], origineY + ecarts[2 * index + 1]);
+    }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, taille); }
+
+    void push_back(const pair<int, int>& coord);
+    void clear();
+    void translater(int dx, int dy);  // Décale toutes les cases
+
+    vector<pair<int, int>> versVecteur() const;
+
+    // Même ordre des cases, comme pour un vector
+    bool operator==(const Coordonnees& autre) const;
+    bool operator!=(const Coordonnees& autre) const { return !(*this == autre); }
+    bool operator<(const Coordonnees& autre) const;
+
+private:
+    int origineX;       // Première case, en stockage interne
+    int origineY;
+    uint32_t taille;
+    bool externe;       // Les cases sont dans 'debordement'
+    int8_t ecarts[2 * CAPACITE_INTERNE];  // x puis y de chaque case, moins l'origine
+    vector<pair<int, int>> debordement;   // Vide tant que les cases tiennent dans l'objet
+
+    void deborder();  // Recopie les cases internes dans le vecteur
+};
+
+#endif
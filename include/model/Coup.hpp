@@ -0,0 +1,55 @@
+#ifndef COUP_HPP
+#define COUP_HPP
+
+#include "OperateurDeplacement.hpp"
+#include "OperateurRotation.hpp"
+#include "OperateurSymetrie.hpp"
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+/************************************************************
+ * Structure Coup
+ * Décrit une transformation légale d'une pièce posée
+ *
+ * Produite par le générateur de coups du Model :
+ * - Le type indique quelle orientation est significative
+ * - Les coordonnées sont celles de la pièce après le coup
+ ************************************************************/
+enum class TypeCoup {
+    DEPLACEMENT,
+    ROTATION,
+    SYMETRIE
+};
+
+struct Coup {
+    size_t piece;                        // Index de la pièce concernée
+    TypeCoup type;                       // Nature de la transformation
+    OrientationDeplacement direction;    // Significatif si type == DEPLACEMENT
+    OrientationRotation rotation;        // Significatif si type == ROTATION
+    OrientationSymetrie symetrie;        // Significatif si type == SYMETRIE
+    pair<int, int> position;             // Position de la pièce (inchangée par le coup)
+    Coordonnees coordonnees;             // Coordonnées de la pièce après le coup
+};
+
+/************************************************************
+ * Structure Apercu
+ * Résultat d'une opération évaluée sans être jouée (Model::apercu...)
+ *
+ * L'empreinte est celle qu'aurait la pièce après l'opération, même
+ * si l'opération est refusée (hors grille, collision...)
+ *
+ * Les transformations exigent les zones autorisées, pas la pose
+ * (placerPiece) : pour un placement, 'valide' ne regarde que la grille
+ * et les autres pièces, et 'dansLesZones' dit si l'empreinte respecte
+ * aussi les zones du niveau.
+ ************************************************************/
+struct Apercu {
+    bool valide;                         // L'opération serait acceptée par le Model
+    pair<int, int> position;             // Position de la pièce après l'opération
+    Coordonnees coordonnees;             // Coordonnées relatives de la pièce après l'opération
+    bool dansLesZones;                   // L'empreinte est dans la grille et les zones autorisées
+};
+
+#endif
@@ -81,6 +81,7 @@ private:
     int width;   // Largeur de la grille
     int height;  // Hauteur de la grille
     vector<unique_ptr<GridComponent>> rows;  // Collection de lignes
+    ostream* messages;  // Explications des placements refusés, nul pour les taire
 
 public:
     Grid(int width, int height);
@@ -92,8 +93,11 @@ public:
     // Méthodes de manipulation des pièces
     bool placePiece(const Piece& piece, int x, int y);
     bool canPlacePiece(const Piece& piece, int x, int y) const;
+    void retirerPiece(const Piece& piece, int x, int y);  // Libère les cases que la pièce occupe à (x, y)
+    const Piece* getOccupant(int x, int y) const;  // nullptr si la case est libre ou hors de la grille
     void clear();
     void afficher(ostream& os) const;
+    void setSortieMessages(ostream* sortie);  // cout par défaut
 };
 
 #endif
\ No newline at end of file
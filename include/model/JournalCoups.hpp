@@ -0,0 +1,114 @@
+#ifndef JOURNALCOUPS_HPP
+#define JOURNALCOUPS_HPP
+
+#include "OperateurDeplacement.hpp"
+#include "OperateurRotation.hpp"
+#include "OperateurSymetrie.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class Model;
+
+// Opérations du Model enregistrées dans un journal
+enum class TypeOperation : uint8_t {
+    PLACEMENT,
+    DEPLACEMENT,
+    ROTATION,
+    SYMETRIE,
+    SELECTION,
+    REINITIALISATION,
+    ANNULATION,
+    RETABLISSEMENT
+};
+
+// Résultat du rejeu d'un journal
+struct BilanRejeu {
+    size_t coups;            // Opérations rejouées
+    bool empreinteValide;    // L'état final est celui de l'enregistrement
+    double secondes;
+};
+
+/************************************************************
+ * Classe JournalCoups
+ * Enregistrement compact des opérations d'une partie, et leur rejeu
+ *
+ * Format (entiers little-endian) :
+ * - En-tête : "PCJR", version (u16), réservé (u16), numéro du niveau (u32),
+ *   nombre d'opérations (u32), taille des opérations en octets (u32),
+ *   empreintes de l'état initial et de l'état final (u64 chacune)
+ * - Opérations : délai depuis la précédente en ms (varint), puis un octet
+ *   type (3 bits de poids fort) et paramètre (5 bits), puis selon le type :
+ *   PLACEMENT : écart à la position précédente de la pièce active (2 varints zigzag),
+ *               le paramètre indique si la pose a réussi
+ *   SELECTION : index de la pièce dans le paramètre, ou 31 suivi d'un varint
+ *   DEPLACEMENT, ROTATION, SYMETRIE : sens dans le paramètre ; pour DEPLACEMENT, 16 indique
+ *               une translation regroupée : écart net (2 varints zigzag) puis nombre de pas (varint)
+ *   REINITIALISATION : 0 pour la position initiale ; 1 (instantané pris) ou
+ *                      2 (instantané restauré) suivi du numéro de l'instantané (varint)
+ *   ANNULATION, RETABLISSEMENT : rien de plus
+ *
+ * Un coup courant tient en deux ou trois octets.
+ *
+ * Responsabilités :
+ * - Recevoir du Model chaque opération qui a modifié son état (Model::setJournal)
+ * - Écrire et relire le journal (écriture atomique par renommage)
+ * - Rejouer le journal sur un Model fraîchement chargé, sans vue, et vérifier l'état final
+ ************************************************************/
+class JournalCoups {
+private:
+    static const uint8_t SELECTION_ETENDUE = 31;
+    static const uint8_t TRANSLATION = 16;       // Paramètre de DEPLACEMENT, au-delà des quatre sens
+    static const uint8_t POSITION_INITIALE = 0;  // Paramètres de REINITIALISATION
+    static const uint8_t INSTANTANE_PRIS = 1;
+    static const uint8_t INSTANTANE_RESTAURE = 2;
+
+    uint32_t niveau;
+    uint32_t nbCoups;
+    uint64_t empreinteInitiale;
+    uint64_t empreinteFinale;
+    vector<uint8_t> octets;  // Opérations encodées
+    chrono::steady_clock::time_point debut;
+    uint32_t dernierTemps;   // ms depuis 'debut' de la dernière opération
+
+    void noter(TypeOperation type, uint8_t parametre);  // Délai, puis octet type/paramètre
+
+public:
+    explicit JournalCoups(int niveau = 0);
+
+    int getNiveau() const { return static_cast<int>(niveau); }
+    size_t getNbCoups() const { return nbCoups; }
+    size_t getTaille() const { return octets.size(); }  // Octets des opérations
+    uint64_t getEmpreinteInitiale() const { return empreinteInitiale; }
+    uint64_t getEmpreinteFinale() const { return empreinteFinale; }
+
+    // Appelées par le Model
+    void commencer(uint64_t empreinte);  // Vide le journal et repart de cet état
+    void terminer(uint64_t empreinte);   // Fixe l'état final
+    void noterPlacement(const pair<int, int>& avant, const pair<int, int>& apres, bool reussi);
+    void noterDeplacement(OrientationDeplacement direction);
+    void noterTranslation(int dx, int dy, unsigned long nbPas);
+    void noterRotation(OrientationRotation sens);
+    void noterSymetrie(OrientationSymetrie sens);
+    void noterSelection(size_t index);
+    void noterReinitialisation();
+    void noterInstantane(uint32_t numero);
+    void noterRestauration(uint32_t numero);
+    void noterAnnulation();
+    void noterRetablissement();
+
+    // Lèvent runtime_error si le fichier ne peut pas être écrit ou n'est pas un journal valide
+    void ecrire(const string& chemin) const;
+    static JournalCoups lire(const string& chemin);
+
+    // Applique les opérations au Model, chargé sur le niveau du journal et encore intact ;
+    // lève runtime_error si l'état initial diffère ou si une opération ne donne plus le même résultat
+    // (dont la restauration d'un instantané pris avant le début de l'enregistrement)
+    BilanRejeu rejouer(Model& model) const;
+};
+
+#endif
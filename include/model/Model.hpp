@@ -7,6 +7,11 @@
 #include "OperateurRotation.hpp"
 #include "OperateurSymetrie.hpp"
 #include "Observer.hpp"
+#include "Coup.hpp"
+#include "Niveau.hpp"
+#include "JournalCoups.hpp"
+#include "ProgressionNiveaux.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <map>
@@ -29,27 +34,128 @@ using namespace std;
  * - Notifier les observateurs des changements
  ************************************************************/
 class Model : public Subject, public Observer {
+public:
+    // État d'une pièce figé dans un instantané ; la forme est partagée entre instantanés
+    struct EtatPiece {
+        shared_ptr<const Coordonnees> forme;
+        pair<int, int> position;
+        bool posee;
+        uint8_t orientation;  // PieceConcrete::getOrientation() de la forme
+    };
+
+    /************************************************************
+     * Instantané de l'état des pièces (positions, formes, poses),
+     * de la pièce active et du nombre de coups
+     *
+     * Immuable et partagé : le copier ne coûte qu'un compteur de références.
+     * Valide pour le Model qui l'a pris tant que ses pièces ne sont pas
+     * remplacées (chargerNiveau, ajouterPiece).
+     ************************************************************/
+    class Instantane {
+        friend class Model;
+        shared_ptr<const vector<EtatPiece>> pieces;
+        const Model* origine;
+        unsigned long generation;   // Génération des pièces du Model à la prise
+        uint32_t numero;            // Identifie l'instantané dans le journal
+        size_t pieceActive;
+        unsigned long nbCoups;
+
+    public:
+        Instantane() : origine(nullptr), generation(0), numero(0), pieceActive(0), nbCoups(0) {}
+        bool estVide() const { return !pieces; }
+        uint32_t getNumero() const { return numero; }
+        size_t getNbPieces() const { return pieces ? pieces->size() : 0; }
+        const EtatPiece& getPiece(size_t index) const { return (*pieces)[index]; }
+    };
+
 private:
     Grid grid;                      // La grille de jeu
     vector<PieceConcrete> pieces;   // Collection de pièces disponibles
     vector<pair<int, int>> positions;  // Positions de chaque pièce
-    vector<pair<int, int>> initialPositions;  // Store initial positions
-    vector<vector<pair<int, int>>> initialCoordinates;  // Store initial coordinates/orientation of pieces
     vector<bool> piecesPosees;      // État de pose de chaque pièce
     size_t pieceActive;             // Index de la pièce active
     set<pair<int, int>> zonesArrivee;  // Positions des zones d'arrivée
     size_t pieceADeplacer;          // Index de la pièce qui doit atteindre la zone
+    OrientationBut orientationBut;  // Orientation exigée à l'arrivée
     int width;                      // Largeur de la grille
     int height;                     // Hauteur de la grille
     set<pair<int, int>> zonesAutorisees;  // Zones où les déplacements sont autorisés
     pair<int, int> zoneArrivee;
-    static vector<bool> completedLevels;  // Track which levels are completed
+    static ProgressionNiveaux progression;  // Niveaux terminés (un bit par niveau)
+
+    // Espace des configurations : les zones autorisées étant fixes pour un niveau,
+    // la validité statique d'un ancrage ne dépend que de l'orientation de la pièce
+    struct OrientationPiece {
+        vector<pair<int, int>> forme;  // Coordonnées normalisées (min x = min y = 0), triées
+        int largeur;                   // Largeur de la boîte englobante
+        int hauteur;                   // Hauteur de la boîte englobante
+        vector<bool> ancrages;         // Bitmap width*height des ancrages valides
+    };
+    // L'orientation suivie par la pièce (PieceConcrete::getOrientation) désigne directement
+    // son entrée et l'ancrage se déduit de sa première case, sans comparer les formes
+    struct ConfigurationPiece {
+        vector<OrientationPiece> orientations;  // Orientations distinctes de la pièce
+        uint8_t orientationBase;                // Orientation de la pièce lors du précalcul
+        uint8_t indexOrientation[PieceConcrete::NB_ORIENTATIONS];      // Par transformation depuis la base
+        pair<int, int> premiereCase[PieceConcrete::NB_ORIENTATIONS];   // Première case, dans la forme normalisée
+    };
+    mutable vector<ConfigurationPiece> espaceConfiguration;  // Par pièce
+    mutable bool espaceConfigurationValide;
+
+    // Atteignabilité de la pièce à déplacer, par ancrage (coin haut-gauche de son empreinte) :
+    // index de l'ancrage précédent sur le chemin, -1 pour le départ, -2 si inatteignable
+    mutable vector<int> predecesseurs;
+    mutable pair<int, int> decalageAtteignabilite;  // Décalage position -> ancrage de la forme courante
+    mutable bool atteignabiliteValide;
+
+    unsigned long revisionZones;  // Incrémentée à chaque modification des zones
+    unsigned long nbCoups;        // Coups joués depuis la position initiale
+    JournalCoups* journal;        // Reçoit chaque opération réussie, nul si aucun
+    ostream* messages;            // Messages destinés au joueur (victoire...), nul pour les taire
+
+    // Historique d'annulation : chaque entrée ne garde que ce qui a changé pour une pièce.
+    // Les formes sont partagées : chaque orientation distincte n'est stockée qu'une fois,
+    // ramenée à sa première case ; l'entrée garde où se trouvait cette case.
+    struct Modification {
+        uint32_t piece;
+        uint32_t formeAvant;     // Index dans formesHistorique
+        uint32_t formeApres;
+        pair<int, int> decalageAvant;  // Première case de la forme avant et après
+        pair<int, int> decalageApres;
+        uint8_t orientationAvant;      // PieceConcrete::getOrientation() avant et après
+        uint8_t orientationApres;
+        pair<int, int> avant;    // Position (ancrage) avant et après
+        pair<int, int> apres;
+        long coups;              // Variation de nbCoups
+        bool poseeAvant;
+        bool poseeApres;
+        bool suiteGroupe;        // Annulée et rétablie avec l'entrée précédente
+    };
+    vector<Modification> historique;
+    size_t curseurHistorique;     // Entrées [0, curseur) annulables, [curseur, fin) rétablissables
+    size_t limiteHistorique;      // Au-delà, l'historique est compacté
+    vector<Coordonnees> formesHistorique;
+    map<Coordonnees, uint32_t> indexFormes;
+
+    // Instantanés : l'état figé le plus récent est gardé et réutilisé tant qu'aucune pièce
+    // n'a changé ; sinon seul l'état des pièces modifiées depuis est recalculé
+    Instantane etatInitial;                 // Cible de resetToInitialPositions
+    unsigned long generationPieces;         // Incrémentée quand les pièces sont remplacées
+    mutable uint32_t prochainInstantane;
+    mutable shared_ptr<const vector<EtatPiece>> dernierEtat;  // Nul : à reconstruire entièrement
+    mutable vector<bool> piecesModifiees;   // Pièces dont dernierEtat est périmé
+    mutable bool dernierEtatPerime;
 
 public:
     // Constructeur et destructeur
     Model(int width = 8, int height = 8);
+    explicit Model(const Niveau& niveau);
     ~Model() override;
 
+    // Chargement et export d'un niveau complet en une seule étape
+    void chargerNiveau(const Niveau& niveau);  // Une seule notification des observateurs
+    Niveau extraireNiveau() const;             // Décrit l'état courant du Model
+
     // Gestion des zones de déplacement
     void ajouterZoneAutorisee(int x, int y);
     void viderZonesAutorisees();
@@ -62,6 +168,9 @@ public:
     bool estZoneArrivee(int x, int y) const;
     const set<pair<int, int>>& getZonesArrivee() const { return zonesArrivee; }
 
+    // Permet aux vues de ne redessiner le décor que lorsque les zones changent
+    unsigned long getRevisionZones() const { return revisionZones; }
+
     // Gestion des dimensions
     int getNbColonnes() const { return width; }
     int getNbLignes() const { return height; }
@@ -72,7 +181,7 @@ public:
     const PieceConcrete& getPieceActive() const;
     size_t getPieceActiveIndex() const;
     size_t getNbPieces() const;
-    const vector<pair<int, int>>& getPieceCoords(size_t index) const;
+    const Coordonnees& getPieceCoords(size_t index) const;
     bool isPiecePosee(size_t index) const;
     pair<int, int> getPosition(size_t index) const;
 
@@ -81,14 +190,72 @@ public:
     void setPieceADeplacer(size_t index);
     pair<int, int> getZoneArrivee() const;
     size_t getPieceADeplacer() const;
+    void setOrientationBut(OrientationBut orientation);
+    OrientationBut getOrientationBut() const;
     bool isPartieGagnee() const;
+    unsigned long getNbCoups() const { return nbCoups; }  // Remis à zéro avec la position initiale
+
+    // Enregistrement des opérations : le journal repart de l'état courant, et reçoit l'état
+    // final quand il est détaché (nullptr) ou remplacé ; il n'appartient pas au Model
+    void setJournal(JournalCoups* journal);
+
+    // Sortie des messages destinés au joueur, pour le modèle et sa grille (cout par défaut) ;
+    // nullptr les fait taire, pour les rejeux et les scripts
+    void setSortieMessages(ostream* sortie);
+    ostream* getSortieMessages() const { return messages; }
+
+    // Annulation et rétablissement des coups, en ne touchant que les cases de la pièce concernée.
+    // Une réinitialisation s'annule d'un bloc. Sans limite atteinte, l'historique est complet ;
+    // au-delà, les coups les plus anciens d'une même pièce sont fusionnés puis les plus anciens
+    // oubliés. Retournent false s'il n'y a rien à annuler ou à rétablir.
+    bool annuler();
+    bool retablir();
+    bool peutAnnuler() const { return curseurHistorique > 0; }
+    bool peutRetablir() const { return curseurHistorique < historique.size(); }
+    void viderHistorique();
+    void setLimiteHistorique(size_t limite);  // En entrées, au moins 2
+    size_t getTailleHistorique() const { return historique.size(); }
+
+    // Empreinte (FNV-1a) de l'état des pièces : positions, formes, poses et pièce active
+    uint64_t getEmpreinte() const;
 
     // Opérations sur la pièce active
     bool placerPiece(int x, int y);
     bool deplacerPiece(OrientationDeplacement direction);
+
+    // Applique une suite de pas d'une case à la position de la pièce active, en une seule opération :
+    // chaque pas illégal (zones, collisions) est ignoré, la grille n'est reconstruite et les
+    // observateurs notifiés qu'une fois. Retourne true si la pièce a bougé.
+    bool translaterPiece(const vector<OrientationDeplacement>& pas);
+    // Même opération déjà résolue (rejeu d'un journal) : écart net (dx, dy) compté comme nbPas coups ;
+    // refusée si l'empreinte d'arrivée n'est pas légale
+    bool translaterPiece(int dx, int dy, unsigned long nbPas);
     bool rotationPiece(OrientationRotation sens);
     bool symetriePiece(OrientationSymetrie sens);
 
+    // Espace des configurations (partie statique de la validation des coups)
+    void precalculerEspaceConfiguration() const;  // À appeler une fois le niveau chargé
+    bool estPlacementStatiqueValide(size_t index, const PieceConcrete& piece,
+                                    const pair<int, int>& position) const;
+
+    // Atteignabilité de la pièce à déplacer par déplacements légaux d'une case
+    // (calculée à la demande et mise en cache jusqu'au prochain changement)
+    bool estPositionAtteignable(const pair<int, int>& position) const;
+    vector<pair<int, int>> getChemin(const pair<int, int>& destination) const;  // Positions successives, départ inclus
+
+    // Aperçus : l'opération sur la pièce 'index' (pas seulement la pièce active) est évaluée
+    // selon les mêmes règles que placerPiece et les transformations, sur l'occupation courante,
+    // sans toucher à la grille ni notifier : utilisables à chaque frame ;
+    // chaque aperçu dit aussi si l'empreinte respecte les zones autorisées (dansLesZones)
+    Apercu apercuPlacement(size_t index, int x, int y) const;
+    Apercu apercuDeplacement(size_t index, OrientationDeplacement direction) const;
+    Apercu apercuRotation(size_t index, OrientationRotation sens) const;
+    Apercu apercuSymetrie(size_t index, OrientationSymetrie sens) const;
+
+    // Générateur de coups légaux (ne modifie ni la grille ni les pièces)
+    vector<Coup> genererCoups() const;              // Coups de toutes les pièces posées
+    vector<Coup> genererCoups(size_t index) const;  // Coups d'une seule pièce
+
     // Gestion de la grille
     void effacerGrille();
     const Grid& getGrille() const;
@@ -97,60 +264,73 @@ public:
     void update() override;
 
     static void setLevelCompleted(int level) {
-        if (completedLevels.size() < static_cast<size_t>(level)) {
-            completedLevels.resize(level, false);
-        }
-        completedLevels[level - 1] = true;
+        progression.marquerTermine(level);
     }
 
     static bool isLevelCompleted(int level) {
-        return level > 0 && static_cast<size_t>(level) <= completedLevels.size() && completedLevels[level - 1];
+        return progression.estTermine(level);
     }
 
-    // Store current positions as initial
-    void storeInitialPositions() {
-        initialPositions = positions;
-        initialCoordinates.clear();
-        for (const PieceConcrete& piece : pieces) {
-            initialCoordinates.push_back(piece.getCoordinates());
-        }
+    // Progression du joueur, en mémoire tant qu'aucun profil n'est ouvert
+    static ProgressionNiveaux& getProgression() {
+        return progression;
     }
 
-    // Reset pieces to initial positions and orientations
-    void resetToInitialPositions() {
-        // Clear the grid first
-        grid.clear();
-
-        // Restore all pieces to their initial positions and orientations
-        for (size_t i = 0; i < pieces.size(); ++i) {
-            // Restore position
-            positions[i] = initialPositions[i];
-            // Restore orientation/coordinates
-            pieces[i].coordinates = initialCoordinates[i];
-
-            if (initialPositions[i].first != -1) {
-                piecesPosees[i] = true;
-                grid.placePiece(pieces[i], positions[i].first, positions[i].second);
-            } else {
-                piecesPosees[i] = false;
-            }
-        }
-
-        // Reset active piece to the piece that needs to be moved
-        pieceActive = pieceADeplacer;
-
-        notifyObservers();
-    }
+    // Instantanés : points de reprise, essais spéculatifs. La prise ne copie aucune forme ;
+    // la restauration ne touche que les pièces qui diffèrent, s'annule d'un bloc et
+    // ne notifie qu'une fois. restaurer lève invalid_argument si l'instantané est vide
+    // ou ne correspond pas aux pièces du Model.
+    Instantane prendreInstantane() const;
+    void restaurer(const Instantane& instantane);
+
+    // Position initiale : instantané pris au chargement du niveau (nombre de coups remis à zéro).
+    // Sans position initiale à jour (jamais fixée, pièces ajoutées depuis), la réinitialisation
+    // adopte la position courante
+    void storeInitialPositions();
+    void resetToInitialPositions();  // Revient à la position initiale, pièce à déplacer active
 
 private:
     // Méthodes utilitaires
     void redessinerGrille(bool notify = true);
     bool verifierVictoire() const;  // Vérifie si la pièce à déplacer a atteint la zone d'arrivée
+    void annoncerVictoire() const;  // Message de victoire, si la pièce active est la pièce à déplacer et a gagné
     bool verifierCollision(int x, int y, size_t pieceIndex) const;  // Vérifie les collisions entre pièces
     bool verifierTransformation();  // Vérifie si une transformation est valide
 
     // Méthode utilitaire pour appliquer une transformation
     bool appliquerTransformation(PieceOperateur& operateur);
+
+    // Utilitaires de l'historique
+    uint32_t indexerForme(const Coordonnees& forme, pair<int, int>& decalage);  // Ramène à la première case
+    Coordonnees formeHistorique(uint32_t forme, const pair<int, int>& decalage) const;
+    void historiser(size_t index, const pair<int, int>& avant, bool poseeAvant,
+                    const PieceConcrete& pieceAvant, long coups, bool suiteGroupe = false);
+    void empilerModification(const Modification& modification);  // Efface ce qui était rétablissable
+    void compacterHistorique();
+    void appliquerHistorique(size_t debut, size_t fin, bool retour);  // Entrées [debut, fin)
+
+    // Utilitaires des instantanés
+    Instantane figerEtat() const;                // Sans numéro ni trace dans le journal
+    void noterModification(size_t index) const;  // La pièce diffère de dernierEtat
+    void remplacerPieces();                      // Les instantanés pris jusqu'ici deviennent invalides
+    // Ramène les pièces et le nombre de coups à l'instantané, historique compris, sans notifier
+    void appliquerInstantane(const Instantane& cible, unsigned long coupsApres);
+
+    // Utilitaires des aperçus
+    bool estEmpreinteLibre(size_t index, const Coordonnees& coords, const pair<int, int>& position) const;
+    Apercu apercuInchange(size_t index) const;  // Opération impossible : l'empreinte actuelle, refusée
+    Apercu apercuTransformation(size_t index, PieceConcrete& copie, PieceOperateur& operateur) const;
+
+    // Utilitaires du générateur de coups
+    vector<int> construireOccupation() const;  // Index de la pièce occupant chaque case (-1 si libre)
+    bool estEmpreinteLegale(const PieceConcrete& piece, const pair<int, int>& position,
+                            size_t pieceIndex, const vector<int>& occupation) const;
+    void genererCoupsPiece(size_t index, const vector<int>& occupation, vector<Coup>& coups) const;
+
+    // Utilitaires de l'espace des configurations et de l'atteignabilité
+    const OrientationPiece* trouverOrientation(size_t index, const PieceConcrete& piece,
+                                               int& minX, int& minY) const;
+    void calculerAtteignabilite() const;
 };
 
 #endif
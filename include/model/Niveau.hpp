@@ -0,0 +1,46 @@
+#ifndef NIVEAU_HPP
+#define NIVEAU_HPP
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+using namespace std;
+
+// Orientation exigée pour la pièce à déplacer sur la zone d'arrivée
+// LIBRE : une case sur l'arrivée suffit (sauf pièce de 4 cases, historiquement horizontale)
+enum class OrientationBut {
+    LIBRE,
+    HORIZONTALE,
+    VERTICALE
+};
+
+/************************************************************
+ * Structure Niveau
+ * Description autonome d'un niveau, indépendante du Model
+ *
+ * Responsabilités :
+ * - Transporter un niveau entre ses formats de stockage et le Model
+ * - Permettre le chargement du Model en une seule étape
+ ************************************************************/
+struct Niveau {
+    int largeur;                             // Largeur de la grille
+    int hauteur;                             // Hauteur de la grille
+    vector<vector<pair<int, int>>> pieces;   // Coordonnées de chaque pièce
+    vector<pair<int, int>> positions;        // Position initiale de chaque pièce (-1,-1 si non posée)
+    vector<bool> posees;                     // Pièce posée au départ : une position posée peut être négative
+    vector<bool> zonesAutorisees;            // Bitmap largeur*hauteur des zones autorisées
+    vector<bool> zonesArrivee;               // Bitmap largeur*hauteur des zones d'arrivée
+    size_t pieceADeplacer;                   // Index de la pièce qui doit atteindre la zone
+    OrientationBut orientationBut;           // Orientation exigée à l'arrivée
+
+    Niveau(int largeur = 0, int hauteur = 0)
+        : largeur(largeur),
+        hauteur(hauteur),
+        zonesAutorisees(static_cast<size_t>(largeur) * hauteur, false),
+        zonesArrivee(static_cast<size_t>(largeur) * hauteur, false),
+        pieceADeplacer(0),
+        orientationBut(OrientationBut::LIBRE) {}
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef NIVEAUPACK_HPP
+#define NIVEAUPACK_HPP
+
+#include "Model.hpp"
+#include "Niveau.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/************************************************************
+ * Pack de niveaux binaire
+ * Regroupe un grand nombre de niveaux dans un seul fichier
+ *
+ * Format (entiers little-endian) :
+ * - En-tête : "PCPK", version (u16), réservé (u16), nombre de niveaux (u32)
+ * - Index : offset (u32) du début de chaque niveau, plus l'offset de fin du fichier
+ * - Niveau : largeur, hauteur, nombre de pièces, pièce à déplacer (u16 chacun),
+ *   orientation exigée à l'arrivée (u8)
+ *   puis pour chaque pièce : nombre de cases (u8), posée (u8), position x et y (i16),
+ *   coordonnées (i8, i8) de chaque case
+ *   puis les bitmaps des zones autorisées et des zones d'arrivée (1 bit par case)
+ ************************************************************/
+
+// Écriture d'un pack à partir de descriptions de niveaux
+class EcrivainPack {
+private:
+    vector<Niveau> niveaux;  // Niveaux à écrire, dans l'ordre du pack
+    uint64_t taillePack;     // Taille du pack écrit avec ces niveaux, en octets
+
+public:
+    EcrivainPack();
+
+    // Lève invalid_argument si le niveau n'est pas représentable dans le format
+    // (valeurs hors de leur champ, positions incohérentes, pack au-delà de 4 Go)
+    void ajouterNiveau(const Niveau& niveau);
+    size_t getNbNiveaux() const { return niveaux.size(); }
+
+    // Écrit le pack dans un fichier temporaire puis le renomme (jamais de pack partiel)
+    void ecrire(const string& chemin) const;
+};
+
+// Lecture d'un pack projeté en mémoire : seuls les niveaux demandés sont décodés
+class LecteurPack {
+private:
+    int descripteur;          // Descripteur du fichier projeté
+    const uint8_t* donnees;   // Début de la projection
+    size_t taille;            // Taille de la projection
+    uint32_t nbNiveaux;       // Nombre de niveaux annoncé par l'en-tête
+
+    // Bornes [debut, fin) du niveau n dans la projection
+    void bornesNiveau(size_t n, size_t& debut, size_t& fin) const;
+
+public:
+    explicit LecteurPack(const string& chemin);
+    ~LecteurPack();
+    LecteurPack(const LecteurPack&) = delete;  // Supprime le constructeur de copie
+    LecteurPack& operator=(const LecteurPack&) = delete;  // Supprime l'opérateur d'affectation
+
+    size_t getNbNiveaux() const { return nbNiveaux; }
+
+    // Décode le niveau n (0 à getNbNiveaux() - 1) directement depuis les octets projetés
+    Niveau lireNiveau(size_t n) const;
+
+    // Construit le Model du niveau n en une seule étape
+    unique_ptr<Model> creerModele(size_t n) const;
+};
+
+#endif
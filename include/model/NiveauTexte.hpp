@@ -0,0 +1,68 @@
+#ifndef NIVEAUTEXTE_HPP
+#define NIVEAUTEXTE_HPP
+
+#include "Niveau.hpp"
+#include <istream>
+#include <ostream>
+#include <string>
+
+using namespace std;
+
+/************************************************************
+ * Format texte des niveaux
+ * Reprend les schémas ASCII utilisés pour concevoir les niveaux
+ *
+ * Un fichier contient une suite de blocs :
+ *   # commentaire
+ *   niveau
+ *   000b0
+ *   0rarr
+ *   praa0
+ *   cible p
+ *   orientation horizontale
+ *
+ * Cases de la grille (une ligne par rangée, toutes de même longueur) :
+ * - '0' ou '.' : case interdite
+ * - 'r' : zone autorisée
+ * - 'b' : zone d'arrivée (autorisée)
+ * - autre minuscule : case d'une pièce, sur une zone autorisée
+ * - majuscule : case d'une pièce, sur une zone d'arrivée
+ *
+ * Les pièces sont numérotées dans l'ordre alphabétique de leur lettre.
+ * 'cible' désigne la pièce à déplacer (facultatif s'il n'y a qu'une pièce),
+ * 'orientation' vaut libre, horizontale ou verticale (libre par défaut).
+ ************************************************************/
+
+// Lecture en flux, bloc par bloc, sans allocation par case
+class LecteurNiveauxTexte {
+private:
+    istream& entree;
+    string ligne;           // Tampon réutilisé d'une ligne à l'autre
+    size_t numeroLigne;     // Pour les messages d'erreur
+    bool enTeteEnAttente;   // L'en-tête du niveau suivant a déjà été lu
+
+    bool lireLigne();       // Lit la ligne suivante sans les blancs de fin
+    [[noreturn]] void erreur(const string& message) const;
+
+public:
+    explicit LecteurNiveauxTexte(istream& entree);
+
+    // Lit le niveau suivant dans 'niveau' (dont la mémoire est réutilisée)
+    // Retourne false en fin de fichier, lève runtime_error en cas d'erreur de syntaxe
+    bool lireNiveau(Niveau& niveau);
+};
+
+// Écriture d'un niveau au format texte
+class EcrivainNiveauxTexte {
+private:
+    ostream& sortie;
+
+public:
+    explicit EcrivainNiveauxTexte(ostream& sortie);
+
+    // Lève invalid_argument si le niveau n'est pas représentable
+    // (pièce non posée, hors grille ou hors des zones autorisées, plus de 24 pièces)
+    void ecrireNiveau(const Niveau& niveau);
+};
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef NIVEAUXINTEGRES_HPP
+#define NIVEAUXINTEGRES_HPP
+
+#include "Model.hpp"
+#include "Niveau.hpp"
+
+/************************************************************
+ * Niveaux intégrés
+ * Les niveaux livrés avec le jeu, construits par appels
+ * successifs au Model
+ *
+ * Utilisés par :
+ * - Le jeu lorsqu'aucun pack de niveaux n'est disponible
+ * - L'outil de création de pack (conversion en format binaire)
+ ************************************************************/
+const int NB_NIVEAUX_INTEGRES = 3;
+const int TAILLE_NIVEAUX_INTEGRES = 7;  // Grilles de 7x7
+
+void configureNiveau1(Model& model);
+void configureNiveau2(Model& model);
+void configureNiveau3(Model& model);
+
+// Configure le niveau numéro (1 à NB_NIVEAUX_INTEGRES) dans un Model de la bonne taille
+void configurerNiveauIntegre(int numero, Model& model);
+
+// Construit la description autonome d'un niveau intégré
+Niveau creerNiveauIntegre(int numero);
+
+#endif
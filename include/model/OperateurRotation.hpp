@@ -54,7 +54,7 @@ private:
      * @return Point central pour la rotation
      * @throws invalid_argument si les coordonnées sont invalides
      */
-    pair<int, int> findRotationCenter(const vector<pair<int, int>>& coords) const;
+    pair<int, int> findRotationCenter(const Coordonnees& coords) const;
 };
 
 /**
@@ -12,7 +12,7 @@ enum class OrientationSymetrie {
 class OperateurSymetrie : public PieceOperateur {
 private:
     OrientationSymetrie sens;
-    pair<int, int> findSymetryCenter(const vector<pair<int, int>>& coords) const;
+    pair<int, int> findSymetryCenter(const Coordonnees& coords) const;
 
 public:
     explicit OperateurSymetrie(Piece& source, const pair<int, int>& position, OrientationSymetrie s);
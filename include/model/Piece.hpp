@@ -1,6 +1,7 @@
 #ifndef PIECE_HPP
 #define PIECE_HPP
 
+#include "Coordonnees.hpp"
 #include <vector>
 #include <utility>
 #include <ostream>
@@ -18,7 +19,7 @@ public:
      */
     virtual void trigger(const pair<int, int>& coord, const Piece& origin) = 0;
     void trigger(const pair<int, int>& coord) { trigger(coord, *this); }
-    virtual const vector<pair<int, int>>& getCoordinates() const = 0;
+    virtual const Coordonnees& getCoordinates() const = 0;
     /**
      * @brief Accepte un visiteur pour appliquer une transformation
      * 
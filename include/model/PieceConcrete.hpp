@@ -2,6 +2,7 @@
 #define PIECECONCRETE_HPP
 
 #include "Piece.hpp"
+#include <cstdint>
 #include <vector>
 
 class PieceOperateur;
@@ -17,8 +18,20 @@ class PieceConcrete : public Piece {
     friend class OperateurSymetrie;
 
 public:
-    PieceConcrete(const vector<pair<int, int>>& coords);
-    virtual const vector<pair<int, int>>& getCoordinates() const override;
+    // Orientations : éléments du groupe des rotations et symétries du carré, codés
+    // r + 4 * s pour « r quarts de tour horaires, puis symétrie verticale si s = 1 »
+    static const uint8_t NB_ORIENTATIONS = 8;
+    static const uint8_t ROTATION_HORAIRE = 1;
+    static const uint8_t ROTATION_ANTIHORAIRE = 3;
+    static const uint8_t SYMETRIE_VERTICALE = 4;    // x devient -x
+    static const uint8_t SYMETRIE_HORIZONTALE = 6;  // y devient -y
+    static uint8_t composerOrientations(uint8_t apres, uint8_t avant);  // 'avant' puis 'apres'
+    static uint8_t inverserOrientation(uint8_t orientation);
+
+    PieceConcrete(const Coordonnees& coords);
+    virtual const Coordonnees& getCoordinates() const override;
+    // Transformation appliquée depuis la construction (les cases gardent leur ordre)
+    uint8_t getOrientation() const { return orientation; }
     /**
      * @brief Déclenche une transformation sur la pièce
      *
@@ -30,7 +43,8 @@ public:
     void afficher(ostream& os) const override;
 
 private:
-    vector<pair<int, int>> coordinates;
+    Coordonnees coordinates;  // Sans allocation jusqu'à Coordonnees::CAPACITE_INTERNE cases
+    uint8_t orientation;      // Mise à jour par les opérateurs de rotation et de symétrie
 };
 
 #endif
@@ -52,9 +52,9 @@ public:
 
     /**
      * @brief Obtient les coordonnées de la pièce
-     * @return Référence constante vers le vecteur de coordonnées
+     * @return Référence constante vers les coordonnées
      */
-    virtual const vector<pair<int, int>>& getCoordinates() const;
+    virtual const Coordonnees& getCoordinates() const;
 
     /**
      * @brief Déclenche une transformation si la position correspond
@@ -0,0 +1,55 @@
+#ifndef PREPARATEURNIVEAUX_HPP
+#define PREPARATEURNIVEAUX_HPP
+
+#include "Model.hpp"
+#include <functional>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/************************************************************
+ * Classe PreparateurNiveaux
+ * Construit les Model des niveaux en arrière-plan
+ *
+ * Responsabilités :
+ * - Lancer la construction d'un niveau sur un autre thread dès qu'il est probable
+ * - Remettre le Model prêt au moment où le niveau est choisi
+ * - Borner le travail en arrière-plan : au plus MAX_PREPARATIONS constructions
+ *   à la fois, une nouvelle demande remplaçant la plus ancienne
+ *
+ * Un Model préparé n'est touché que par son thread de construction,
+ * puis uniquement par le thread d'affichage après sa remise.
+ ************************************************************/
+class PreparateurNiveaux {
+public:
+    typedef function<unique_ptr<Model>(int)> Fabrique;
+
+    static const size_t MAX_PREPARATIONS = 2;  // Threads et Model préparés, abandonnés compris
+
+    explicit PreparateurNiveaux(Fabrique fabrique);
+    ~PreparateurNiveaux();  // Attend les constructions en cours
+
+    // Lance la construction du niveau si elle n'est pas déjà lancée ; la plus ancienne
+    // préparation est abandonnée s'il n'y a plus de place, et la demande est ignorée
+    // si toutes les places sont encore prises par des constructions abandonnées
+    void preparer(int niveau);
+
+    // Remet le Model du niveau (attend la fin de sa construction,
+    // ou le construit sur place s'il n'a pas été préparé)
+    unique_ptr<Model> prendre(int niveau);
+
+private:
+    Fabrique fabrique;
+    vector<pair<int, future<unique_ptr<Model>>>> enCours;  // Constructions lancées, la plus ancienne d'abord
+    vector<future<unique_ptr<Model>>> abandonnees;         // Remplacées mais pas encore terminées
+
+    void oublierTerminees();  // Libère les constructions abandonnées qui ont fini
+
+    PreparateurNiveaux(const PreparateurNiveaux&) = delete;
+    PreparateurNiveaux& operator=(const PreparateurNiveaux&) = delete;
+};
+
+#endif
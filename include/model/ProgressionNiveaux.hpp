@@ -0,0 +1,86 @@
+#ifndef PROGRESSIONNIVEAUX_HPP
+#define PROGRESSIONNIVEAUX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Meilleurs résultats d'un niveau ; 0 signifie "aucun"
+struct RecordNiveau {
+    uint32_t coups;
+    uint32_t millisecondes;
+};
+
+/************************************************************
+ * Classe ProgressionNiveaux
+ * Progression d'un joueur : niveaux terminés et records, un fichier par profil
+ *
+ * Format (entiers little-endian) :
+ * - En-tête : "PCPG", version (u16), réservé (u16), capacité en niveaux (u32, multiple de 64),
+ *   réservé (u32)
+ * - Bitset : un bit par niveau, en mots de 64 bits (niveau n : bit (n - 1) % 64 du mot (n - 1) / 64)
+ * - Records : meilleur nombre de coups (u32) et meilleur temps en ms (u32) de chaque niveau
+ *
+ * Responsabilités :
+ * - Répondre en O(1) depuis le fichier projeté en mémoire, sans le décoder
+ * - Écrire chaque mise à jour dans un fichier temporaire renommé ensuite :
+ *   un arrêt brutal laisse l'ancienne version ou la nouvelle, jamais un mélange
+ * - Fonctionner aussi sans fichier (progression en mémoire, perdue à la fin du processus)
+ *
+ * Toutes les méthodes peuvent être appelées depuis plusieurs threads.
+ ************************************************************/
+class ProgressionNiveaux {
+public:
+    ProgressionNiveaux();  // En mémoire, sans fichier
+    ~ProgressionNiveaux();
+
+    // Projette le fichier, créé vide s'il n'existe pas ; remplace la progression courante
+    // Lève runtime_error si le fichier est illisible ou invalide
+    void ouvrir(const string& chemin);
+
+    // Fichier du profil 'profil' (lettres, chiffres, '-' et '_') dans 'repertoire', créé au besoin
+    // Lève invalid_argument si le nom n'est pas valide
+    void ouvrirProfil(const string& repertoire, const string& profil);
+
+    // Niveaux numérotés à partir de 1 ; hors bornes = non terminé, sans record
+    bool estTermine(int niveau) const;
+    RecordNiveau getRecord(int niveau) const;
+
+    // Nombre de niveaux terminés parmi 1..nbNiveaux
+    size_t compterTermines(int nbNiveaux) const;
+
+    // Marque le niveau terminé et garde séparément le plus petit nombre de coups et le
+    // meilleur temps (0 : inconnu) ; vrai si la progression a changé
+    // Lève runtime_error si la progression ne peut pas être écrite
+    bool enregistrer(int niveau, uint32_t coups, uint32_t millisecondes);
+    void marquerTermine(int niveau) { enregistrer(niveau, 0, 0); }
+
+private:
+    // Fragment de la nouvelle image du fichier ; octets nul = 'taille' zéros
+    struct Morceau {
+        const uint8_t* octets;
+        size_t taille;
+    };
+
+    string chemin;           // Vide : progression en mémoire
+    const uint8_t* projection;  // Fichier projeté, nul sans fichier
+    vector<uint8_t> memoire; // Image sans fichier, même format que le fichier
+    const uint8_t* donnees;  // Image courante : la projection ou la mémoire
+    size_t taille;
+    uint32_t capacite;       // Niveaux couverts par l'image
+    mutable mutex verrou;
+
+    void fermer();
+    void projeter(const string& fichier);  // Remplace l'image courante par le fichier projeté
+    void remplacer(const vector<Morceau>& morceaux);  // Nouvelle image, écrite atomiquement
+    void agrandir(uint32_t niveaux);  // Capacité d'au moins 'niveaux'
+
+    ProgressionNiveaux(const ProgressionNiveaux&) = delete;
+    ProgressionNiveaux& operator=(const ProgressionNiveaux&) = delete;
+};
+
+#endif
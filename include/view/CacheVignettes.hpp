@@ -0,0 +1,89 @@
+#ifndef CACHEVIGNETTES_HPP
+#define CACHEVIGNETTES_HPP
+
+#include "model/Niveau.hpp"
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace sf;
+
+/************************************************************
+ * Classe CacheVignettes
+ * Vignettes des niveaux pour le menu, rendues en arrière-plan
+ *
+ * Responsabilités :
+ * - Rendre les niveaux demandés sur un thread dédié (RenduLogiciel, sans OpenGL)
+ * - Garder au plus 'capacite' textures, en évinçant la moins récemment affichée
+ * - Ne rendre que les niveaux encore visibles : chaque demande remplace la file
+ *
+ * Le thread de rendu ne touche ni SFML ni le cache : les textures sont créées
+ * par integrerRendues(), sur le thread de la fenêtre.
+ ************************************************************/
+class CacheVignettes {
+public:
+    typedef function<Niveau(int)> Source;  // Description du niveau numéro n (1..)
+
+    // Les vignettes tiennent dans tailleMax, avec au moins 4 pixels par case
+    CacheVignettes(Source source, size_t capacite, Vector2u tailleMax);
+    ~CacheVignettes();  // Arrête le thread après le rendu en cours
+
+    // Texture du niveau si elle est prête (elle devient la plus récente), nullptr sinon
+    const Texture* obtenir(int niveau);
+
+    // Remplace la file de rendu par les niveaux manquants de cette liste, dans l'ordre
+    void demander(const vector<int>& niveaux);
+
+    // Crée les textures des vignettes rendues ; vrai si au moins une est arrivée
+    bool integrerRendues();
+
+    // Des vignettes demandées ne sont pas encore intégrées
+    bool enAttente() const;
+
+private:
+    struct Entree {
+        Texture texture;
+        list<int>::iterator recence;  // Position dans 'parRecence'
+    };
+
+    struct Rendu {
+        int niveau;
+        unsigned largeur;
+        unsigned hauteur;
+        vector<Uint8> rgba;  // Vide si le niveau n'a pas pu être rendu
+    };
+
+    Source source;
+    size_t capacite;
+    Vector2u tailleMax;
+
+    // Thread de la fenêtre uniquement
+    unordered_map<int, Entree> textures;
+    list<int> parRecence;  // Du plus récent au plus ancien
+    set<int> echecs;       // Niveaux illisibles, jamais redemandés
+
+    // Partagé avec le thread de rendu
+    mutable mutex verrou;
+    condition_variable reveil;
+    deque<int> file;        // Niveaux à rendre, le plus prioritaire en tête
+    vector<Rendu> rendus;   // Rendus terminés, pas encore intégrés
+    int enCours;            // Niveau en cours de rendu, 0 sinon
+    bool arret;
+    thread travailleur;
+
+    void boucleRendu();
+    Rendu rendre(int niveau) const;
+
+    CacheVignettes(const CacheVignettes&) = delete;
+    CacheVignettes& operator=(const CacheVignettes&) = delete;
+};
+
+#endif
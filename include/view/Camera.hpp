@@ -0,0 +1,51 @@
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+/************************************************************
+ * Classe Camera
+ * Partie du plateau affichée dans le panneau de la grille
+ *
+ * Responsabilités :
+ * - Produire la View (centre, zoom, viewport) utilisée pour dessiner le plateau
+ * - Déplacer et zoomer sans jamais quitter le plateau
+ * - Donner la zone visible pour ne construire que ce qui s'y trouve
+ *
+ * Coordonnées "monde" : la case (x, y) occupe [x, x+1[ * tuile, [y, y+1[ * tuile.
+ ************************************************************/
+class Camera {
+public:
+    Camera();
+
+    // pane : panneau de la grille dans la fenêtre ; windowSize : taille logique de la fenêtre
+    // worldSize : taille du plateau en coordonnées monde
+    void setup(const FloatRect& pane, const Vector2f& windowSize, const Vector2f& worldSize);
+
+    void reset();                                          // Zoom 1 (ou plateau entier), plateau centré
+    void centerOn(const Vector2f& world);
+    void pan(const Vector2f& pixels);                      // Le plateau suit le déplacement de la souris
+    void zoomAt(float factor, const Vector2f& worldAnchor);  // Le point 'worldAnchor' reste sous le curseur
+
+    const View& getView() const { return view; }
+    FloatRect getVisibleArea() const;                      // Zone visible, en coordonnées monde
+    float getZoom() const { return zoom; }
+
+    // Incrémentée à chaque changement de la vue
+    unsigned long getRevision() const { return revision; }
+
+private:
+    FloatRect pane;
+    Vector2f worldSize;
+    Vector2f center;
+    float zoom;
+    float minZoom;
+    View view;
+    unsigned long revision;
+
+    void apply();  // Borne centre et zoom puis met à jour la View
+};
+
+#endif
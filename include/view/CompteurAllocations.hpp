@@ -0,0 +1,16 @@
+#ifndef COMPTEURALLOCATIONS_HPP
+#define COMPTEURALLOCATIONS_HPP
+
+/************************************************************
+ * Comptage des allocations
+ * Remplace l'operator new global de l'exécutable qui lie ce module
+ *
+ * Utilisé par :
+ * - Le FrameProfiler de l'exécutable graphique (allocations par frame)
+ * - L'outil de rejeu des journaux (allocations par opération du modèle)
+ ************************************************************/
+
+// Allocations (operator new) du processus depuis son lancement, tous threads confondus
+unsigned long getNbAllocations();
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "model/Model.hpp"
 #include "model/Observer.hpp"
+#include "view/TamponConsole.hpp"
 #include <iostream>
 
 /************************************************************
@@ -20,6 +21,7 @@
 class ConsoleView : public Observer {
 private:
     Model& model;  // Référence vers le modèle
+    TamponConsole tampon;  // Grille numérotée, réaffichée case par case
 
     // Codes couleur ANSI
     const string RESET = "\033[0m";
@@ -28,9 +30,10 @@ private:
     const string JAUNE = "\033[33m";
 
     // Méthodes d'affichage
-    void afficherGrilleNumerotee() const;
-    void afficherPieces() const;
-    void afficherMenu() const;
+    void afficherEcran();  // Grille, pièces et menu en une seule écriture
+    void composerGrilleNumerotee();
+    void afficherPieces(ostream& os) const;
+    void afficherMenu(ostream& os) const;
     
     // Méthodes de lecture
     int lireChoix() const;
@@ -0,0 +1,84 @@
+#ifndef FRAMEPROFILER_HPP
+#define FRAMEPROFILER_HPP
+
+#include <SFML/System.hpp>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace sf;
+
+/************************************************************
+ * Classe FrameProfiler
+ * Mesures de chaque frame dessinée par une scène
+ *
+ * Responsabilités :
+ * - Chronométrer les sections d'une frame (événements, modèle, lots, dessin)
+ * - Compter les appels de dessin et les allocations de la frame
+ * - Mesurer la latence entre une touche reçue et la frame qui l'affiche
+ * - Résumer les dernières frames (percentiles) et les exporter en CSV
+ *
+ * Une frame commence à la première activité qui suit la frame précédente
+ * et se termine à sa présentation (display). Les sections sont inclusives :
+ * le temps MODELE est aussi compté dans la section qui appelle le modèle.
+ ************************************************************/
+class FrameProfiler {
+public:
+    enum Section { EVENEMENTS, MODELE, LOTS, DESSIN, NB_SECTIONS };
+
+    // Chronomètre une section pour la durée d'un bloc
+    class Mesure {
+    public:
+        Mesure(FrameProfiler& profiler, Section section);
+        ~Mesure();
+
+    private:
+        FrameProfiler& profiler;
+        Section section;
+        Clock horloge;
+    };
+
+    FrameProfiler();
+
+    void noteActivite();      // Début de frame s'il n'y en a pas en cours
+    void noteTouche();        // Touche reçue : départ de la mesure de latence
+    void noteAppelDessin() { ++courant.appelsDessin; }
+    void notePresentation();  // Fin de la frame : l'échantillon est conservé
+    void abandonnerFrame();   // L'activité n'a produit aucune frame
+
+    // Résumé des frames conservées, sur quelques lignes
+    string resume() const;
+
+    // Lève runtime_error si le fichier ne peut pas être écrit
+    void exporterCsv(const string& chemin) const;
+
+    // Allocations (operator new) du processus depuis son lancement, tous threads confondus
+    static unsigned long getNbAllocations();
+
+private:
+    static const size_t CAPACITE = 3600;  // Une minute à 60 images par seconde
+
+    struct Echantillon {
+        Int64 duree;                  // Microsecondes, de la première activité à la présentation
+        Int64 sections[NB_SECTIONS];
+        unsigned long appelsDessin;
+        unsigned long allocations;
+        Int64 latence;                // -1 si aucune touche n'attendait cette frame
+    };
+
+    vector<Echantillon> echantillons;  // Tampon circulaire
+    size_t suivant;                    // Prochaine case écrite
+    unsigned long nbFrames;            // Frames mesurées depuis la création
+
+    Echantillon courant;
+    bool frameEnCours;
+    Clock horlogeFrame;
+    unsigned long allocationsDebut;
+    bool toucheEnAttente;
+    Clock horlogeLatence;
+
+    void reinitialiserCourant();
+    vector<Echantillon> ordonnes() const;  // Du plus ancien au plus récent
+};
+
+#endif
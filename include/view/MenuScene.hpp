@@ -0,0 +1,102 @@
+#ifndef MENUSCENE_HPP
+#define MENUSCENE_HPP
+
+#include "view/CacheVignettes.hpp"
+#include "view/Scene.hpp"
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace sf;
+
+/************************************************************
+ * Classe MenuScene
+ * Menu principal : grille défilante des niveaux, ou sortie du jeu
+ *
+ * Responsabilités :
+ * - Afficher les niveaux, leur vignette et leur état (terminé ou non)
+ * - Ne créer des widgets que pour les cases visibles : le coût d'ouverture
+ *   et de défilement ne dépend pas du nombre de niveaux
+ * - Surligner la case sous la souris (position calculée, sans parcours des cases)
+ * - Prévenir l'application du niveau survolé pour qu'elle le prépare, une fois
+ *   le survol stabilisé (balayer la grille ne lance aucune préparation)
+ ************************************************************/
+class MenuScene : public Scene {
+public:
+    static const int AUCUN_CHOIX = -1;
+    static const int QUITTER = 0;
+
+    // Taille maximale d'une vignette dans sa case
+    static const unsigned int LARGEUR_VIGNETTE = 170;
+    static const unsigned int HAUTEUR_VIGNETTE = 120;
+
+    // nbNiveaux cases de niveau, puis "Quitter" ; survolNiveau reçoit le numéro (1..n) survolé
+    // vignettes peut être nul : les cases restent alors sans image
+    MenuScene(RenderWindow& window, int nbNiveaux, CacheVignettes* vignettes,
+              function<void(int)> survolNiveau);
+
+    // Scene
+    void activate() override;
+    void handleEvent(const Event& event) override;
+    void advance() override;
+    // Un survol en attente garde la boucle éveillée jusqu'à la fin du délai
+    bool needsRedraw() const override { return redrawPending || attenteVignettes || survolEnAttente > 0; }
+    void draw() override;
+    bool isFinished() const override { return choice != AUCUN_CHOIX; }
+
+    // Numéro du niveau choisi (1..n), QUITTER, ou AUCUN_CHOIX si la fenêtre a été fermée
+    int getChoice() const { return choice; }
+
+private:
+    static const unsigned int WIDTH = 800;
+    static const unsigned int HEIGHT = 600;
+
+    // Grille des niveaux : fenêtre de défilement entre le titre et "Quitter"
+    static const int COLONNES = 4;
+    static const int HAUT_GRILLE = 110;
+    static const int HAUTEUR_GRILLE = 420;
+    static const int MARGE_GAUCHE = 20;
+    static const int LARGEUR_CASE = 190;
+    static const int HAUTEUR_CASE = 170;
+    static const int ESPACE_CASE = 5;  // Marge intérieure de chaque case
+
+    static const int DELAI_SURVOL_MS = 200;  // Survol immobile avant de préparer le niveau
+
+    RenderWindow& window;
+    CacheVignettes* vignettes;
+    View uiView;
+    View gridView;    // Contenu de la grille, décalé du défilement
+    Text title;
+    Text progressText;
+    Text quitText;
+    RectangleShape cellBox;   // Fond d'une case, repositionné pour chaque case visible
+    Sprite thumbnail;         // Vignette d'une case, idem
+    RectangleShape scrollBar;
+
+    // Étiquettes des cases visibles : le niveau n occupe l'étiquette (n - 1) % labels.size(),
+    // seules les étiquettes des rangées qui apparaissent sont réécrites
+    vector<Text> labels;
+    vector<int> labelLevels;  // Niveau affiché par chaque étiquette, 0 si aucun
+    vector<int> lastRequest;  // Dernière liste de vignettes demandées
+
+    int nbNiveaux;
+    float scroll;           // Décalage vertical de la grille, en pixels
+    float maxScroll;
+    Vector2i lastMouse;     // Dernière position de la souris, pour le survol après défilement
+    int hovered;            // Index survolé (nbNiveaux pour "Quitter"), -1 sinon
+    int choice;
+    bool redrawPending;
+    bool attenteVignettes;  // Des vignettes visibles sont en cours de rendu
+    function<void(int)> survolNiveau;
+    int survolEnAttente;    // Niveau (1..n) survolé, pas encore annoncé ; 0 si aucun
+    Clock survolClock;      // Depuis le dernier changement de survol
+
+    int optionAt(const Vector2i& pixel) const;  // Index sous le pixel, -1 sinon
+    void setHovered(int index);
+    void setScroll(float offset);
+    void visibleRange(int& first, int& last) const;  // Index [first, last) visibles
+};
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef RENDULOGICIEL_HPP
+#define RENDULOGICIEL_HPP
+
+#include "model/Model.hpp"
+#include "model/Niveau.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/************************************************************
+ * Rendu logiciel
+ * Dessine un niveau dans une image en mémoire, sans fenêtre ni OpenGL
+ *
+ * Responsabilités :
+ * - Reproduire le plateau de SFMLView (panneau, lignes, zones, pièces)
+ * - Écrire l'image au format PPM ou PNG, sans bibliothèque externe
+ *
+ * Utilisé par l'outil de vignettes et par le menu de sélection des niveaux.
+ ************************************************************/
+
+struct CouleurRGB {
+    uint8_t r, g, b;
+};
+
+// Image RGB 8 bits, rangées de haut en bas
+class ImageRGB {
+private:
+    int largeur;
+    int hauteur;
+    vector<uint8_t> pixels;  // 3 octets par pixel
+
+public:
+    ImageRGB(int largeur = 0, int hauteur = 0, CouleurRGB fond = CouleurRGB{255, 255, 255});
+
+    int getLargeur() const { return largeur; }
+    int getHauteur() const { return hauteur; }
+    const vector<uint8_t>& getPixels() const { return pixels; }
+
+    // Rectangle plein, découpé aux bords de l'image ; 'alpha' de 0 (invisible) à 255 (opaque)
+    void remplirRectangle(int x, int y, int l, int h, CouleurRGB couleur, uint8_t alpha = 255);
+
+    // Lèvent runtime_error si le fichier ne peut pas être écrit
+    void ecrirePPM(const string& chemin) const;
+    void ecrirePNG(const string& chemin) const;  // Deflate sans compression (blocs stockés)
+};
+
+// Plateau du niveau, 'tailleCase' pixels par case (au moins 4)
+// 'pieceActive' reçoit la bordure dorée, comme dans SFMLView (aucune si hors bornes)
+ImageRGB rendreNiveau(const Niveau& niveau, int tailleCase, size_t pieceActive = static_cast<size_t>(-1));
+
+// État courant d'un Model (positions et orientations des pièces, pièce active)
+ImageRGB rendreModele(const Model& model, int tailleCase);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef RESSOURCES_HPP
+#define RESSOURCES_HPP
+
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+/************************************************************
+ * Classe Ressources
+ * Cache des ressources graphiques partagé par tout le processus
+ *
+ * Responsabilités :
+ * - Fournir la police intégrée à l'exécutable (resources/arial.ttf)
+ * - Ne la charger qu'une seule fois, au premier usage, sans accès disque
+ * - La partager entre le menu et les vues des niveaux
+ ************************************************************/
+class Ressources {
+public:
+    // Police de l'interface, chargée depuis la mémoire au premier appel
+    static const Font& getPolice();
+
+    // Durée du chargement de la police en microsecondes, -1 si elle n'est pas encore chargée
+    static Int64 getDureeChargementPolice();
+
+private:
+    Ressources() = delete;  // Classe purement statique
+};
+
+#endif
@@ -2,6 +2,11 @@
 
 #include "model/Model.hpp"
 #include "model/Observer.hpp"
+#include "view/Camera.hpp"
+#include "view/FrameProfiler.hpp"
+#include "view/Ressources.hpp"
+#include "view/Scene.hpp"
+#include "view/Timeline.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <map>
@@ -10,15 +15,24 @@
 using namespace std;
 using namespace sf;
 
-class SFMLView : public Observer {
+// Scène d'un niveau, affichée dans la fenêtre partagée du SceneManager
+class SFMLView : public Observer, public Scene {
 public:
-    SFMLView(Model& m);
+    SFMLView(Model& m, RenderWindow& window);
     ~SFMLView();
 
-    void run();
     void update() override;
     bool shouldReturnToMenu() const { return returnToMenu; }
-    void setWindowTitle(const string& title) { window.setTitle(title); }
+    void setWindowTitle(const string& title);
+
+    // Scene
+    void activate() override;
+    void handleEvent(const Event& event) override;
+    void advance() override;
+    bool needsRedraw() const override { return redrawPending || timeline.isRunning(); }
+    void draw() override;
+    bool isFinished() const override { return finished; }
+    void printStats() const override;
 
 private:
     // Constantes de l'interface
@@ -26,12 +40,16 @@ private:
     static const int MARGIN_TOP = 50;
     static const int MARGIN_LEFT = 50;
     static const int MARGIN_RIGHT = 200;
-    static const int MARGIN_BOTTOM = 50;
+    static const int MARGIN_BOTTOM = 70;
     static const int BUTTON_WIDTH = 150;
     static const int BUTTON_HEIGHT = 30;
     static const int BUTTON_SPACING = 10;
+    static const int MAX_VISIBLE_ROWS = 15;  // Au-delà, la caméra ne montre qu'une partie du plateau
+    static const int MAX_VISIBLE_COLS = 20;
+    static const int MIN_OUTLINE_PIXELS = 12;  // Taille de case sous laquelle les contours sont omis
+    static const int MIN_LINE_PIXELS = 6;      // Taille de case sous laquelle les lignes sont omises
 
-    // Dimensions de la grille
+    // Dimensions de la grille (VISIBLE_* : taille du panneau, en cases au zoom 1)
     int VISIBLE_ROWS;
     int VISIBLE_COLS;
     int NB_COL;
@@ -39,15 +57,81 @@ private:
 
     // Références et objets principaux
     Model& model;
-    RenderWindow window;
-    Font font;
+    RenderWindow& window;  // Fenêtre partagée entre toutes les scènes
+    string windowTitle;
+    const Font& font;  // Police partagée (voir Ressources)
+
+    // Caméra du plateau : le plateau est dessiné dans sa View, l'interface dans uiView
+    Camera camera;
+    View uiView;
+    IntRect visibleCells;             // Cases visibles (culling), bornées au plateau
+    unsigned long batchCameraRevision;  // Révision de la caméra lors de la dernière reconstruction
+    bool boardOutlines;               // Contours dessinés au zoom courant
+    bool isPanning;                   // Déplacement de la vue au clic droit
+    Vector2i panLast;
 
     // Éléments de l'interface
     RectangleShape gridPane;
     VertexArray gridLines;
     vector<RectangleShape> buttons;
     vector<Text> buttonLabels;
-    vector<RectangleShape> pieceShapes;     // Formes des pièces
+
+    // Décor statique (panneau et boutons) composé une fois hors écran
+    RenderTexture background;
+    Sprite backgroundSprite;
+    bool backgroundAvailable;             // RenderTexture créée (sinon dessin direct)
+    bool backgroundDirty;                 // À recomposer (ouverture, redimensionnement)
+    unsigned long boardZonesRevision;     // Révision des zones du modèle dans boardBatch
+    vector<bool> buttonEnabled;           // Boutons actifs (les autres sont grisés par-dessus le décor)
+
+    // Textes de l'interface, créés une fois et mis à jour seulement si leur contenu change
+    Text activePieceText;
+    Text controlsText1;
+    Text controlsText2;
+    Text controlsText3;
+    Text victoryText;
+    RectangleShape victoryOverlay;
+    size_t displayedActivePiece;     // Index affiché par activePieceText
+    unsigned long textRebuildCount;  // Mises en page de texte depuis l'ouverture
+
+    // Lots de sommets (Quads) : une case = un remplissage et quatre bandes de contour
+    VertexArray boardBatch;   // Zones autorisées et zones d'arrivée
+    VertexArray pieceBatch;   // Pièces posées
+    VertexArray dragBatch;    // Fantôme de la pièce déplacée à la souris
+    bool batchesDirty;        // Le modèle a changé depuis la dernière reconstruction
+    size_t batchActivePiece;  // Pièce active lors de la dernière reconstruction
+    Vector2i dragCell;        // Case du fantôme lors de la dernière reconstruction
+    bool dragValid;           // Le lâcher à la position de la souris serait accepté
+
+    // Rendu à la demande : le SceneManager dort dans waitEvent tant que rien ne change
+    bool redrawPending;         // Une frame doit être dessinée
+
+    // Profil des frames (F3 : affichage, F4 : export CSV)
+    FrameProfiler profiler;
+    bool profilerVisible;
+    Text profilerText;
+    RectangleShape profilerPanel;
+    Clock profilerRefresh;      // Le résumé n'est recalculé que quatre fois par seconde
+
+    // Animations (glissements de pièces, victoire), sans jamais bloquer la boucle
+    struct PieceSlide {
+        VertexArray cells;      // Cases de la pièce à sa position d'arrivée
+        vector<Vector2f> path;  // Décalages successifs par rapport à l'arrivée (le dernier est nul)
+        Vector2f offset;        // Décalage courant
+    };
+    Timeline timeline;
+    Clock frameClock;                       // Temps écoulé entre deux appels à advance()
+    bool wasAnimating;                      // Une animation tournait au tour précédent
+    map<size_t, PieceSlide> slides;         // Pièces en cours de glissement
+    vector<pair<int, int>> shownPositions;  // Positions du modèle déjà prises en compte
+    vector<pair<int, int>> pendingPath;     // Chemin du prochain déplacement de pendingPathPiece
+    size_t pendingPathPiece;
+    float victoryFade;                      // Opacité du message de victoire (0 à 1)
+
+    // Entrées regroupées par frame : déplacement net au clavier, dernière position du glisser
+    vector<OrientationDeplacement> pendingSteps;
+    bool dragMovePending;
+    Vector2i pendingDragPos;
 
     // État de l'interface
     Vector2i selectedCell;
@@ -56,27 +140,25 @@ private:
     Vector2f dragOffset;
     bool victoryDisplayed;
     bool returnToMenu;  // Indicateur de retour au menu
+    bool finished;      // Le niveau est quitté ou gagné
 
     // Textures et sprites
     map<string, Texture> textures;    // Textures pour les pièces
 
     // Initialisation
-    void loadFonts();
     void initWindow();
     void initGrid();
     void initGridPane();
-    void initHorizontalLines(int& lineIndex);
-    void initVerticalLines(int& lineIndex);
     void initButtons();
+    void initHudTexts();
     void loadTextures();
-    void initPieceShapes();  // Initialisation des formes des pièces
 
     // Gestion des événements
-    void handleEvents();
     void handleKeyPress(Keyboard::Key key);
     void handleNavigationKeys(Keyboard::Key key);
     void handleTransformationKeys(Keyboard::Key key);
     void handlePieceMovement(Keyboard::Key key);
+    void applyPendingInput();  // Applique les entrées regroupées depuis la dernière frame
     void handleMouseClick(const Vector2i& mousePos);
     void handleMouseMove(const Vector2i& mousePos);
     void handleMouseRelease(const Vector2i& mousePos);
@@ -87,36 +169,58 @@ private:
 
     // Dessin
     void drawGrid();
+    void rebuildBackground();
+    void drawStaticLayer(RenderTarget& target);  // Panneau et boutons actifs
     void drawPieces();
     void drawButtons();
+    void updateButtonStates();  // Calcule les transformations possibles
+    void drawButton(RenderTarget& target, size_t index, bool enabled);
     void drawUI();
     void drawActivePieceInfo();
     void drawControlsInfo();
     void drawVictoryMessage();
     void drawVictoryOverlay();
-    void createVictoryText(Text& victoryText);
+    void createVictoryText(Text& text);
     void centerText(Text& text);
     void handleVictoryCondition();
     void drawFrame();
-    void updatePieceShapes();  // Mise à jour des formes des pièces
-    void createPieceShape(const Vector2i& gridPos, const Color& fillColor, const Color& outlineColor, int outlineThickness);
-    void updateStaticPieces();
-    void updateDraggedPiece();
+    void drawProfiler();
+    void exportProfile();
+    void submit(const Drawable& drawable, const RenderStates& states = RenderStates::Default);  // Dessin compté
+    void submit(RenderTarget& target, const Drawable& drawable);
+
+    // Lots de sommets
+    void appendCell(VertexArray& batch, const Vector2i& gridPos, const Color& fillColor, const Color& outlineColor, float outlineThickness);
+    void appendQuad(VertexArray& batch, float left, float top, float width, float height, const Color& color);
+    void updateBatches();  // Reconstruit les lots si le modèle ou la pièce active ont changé
+    void rebuildBoardBatch();
+    void rebuildGridLines();
+    bool updateVisibleCells();  // Retourne true si la zone visible ou le niveau de détail a changé
+    void rebuildPieceBatch();
+    void rebuildDragBatch(const Vector2i& mousePos);
+
+    // Animations
+    void detectMovedPieces();  // Lance un glissement pour chaque pièce déplacée dans le modèle
+    void startSlide(size_t pieceIndex, const vector<pair<int, int>>& gridPath);
+    static Vector2f pointOnPath(const vector<Vector2f>& path, float t);
+    void setVictoryFade(float fade);
 
     // Utilitaires
     Vector2i windowToGrid(const Vector2i& windowPos) const;
     Vector2f gridToWindow(const Vector2i& gridPos) const;
+    Vector2f gridToWorld(const Vector2i& gridPos) const;
     bool isInsideGrid(const Vector2i& pos) const;
+    bool isInsidePane(const Vector2i& windowPos) const;
     bool isVisibleInGrid(const Vector2i& pos) const;
     bool isInsideButton(const Vector2i& pos, int buttonIndex) const;
     bool isValidMove(const pair<int, int>& newPos);
-    bool isPathClear(const pair<int, int>& start, const pair<int, int>& end);
-    bool isPositionOccupied(int x, int y);
-    bool isVerticalPathClear(const pair<int, int>& start, const pair<int, int>& end);
-    bool isHorizontalPathClear(const pair<int, int>& start, const pair<int, int>& end);
 
     // Gestion du drag & drop
     void startDragging(size_t pieceIndex, const Vector2i& mousePos);
     void stopDragging();
     void updateDraggedPiece(const Vector2i& mousePos);
+
+    // Caméra
+    void handleCameraEvent(const Event& event);
+    void ensurePieceVisible(size_t pieceIndex);
 };
\ No newline at end of file
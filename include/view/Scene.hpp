@@ -0,0 +1,37 @@
+#ifndef SCENE_HPP
+#define SCENE_HPP
+
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+/************************************************************
+ * Interface Scene
+ * Écran affiché dans la fenêtre unique du jeu (menu, niveau)
+ *
+ * Responsabilités :
+ * - Réagir aux événements que lui transmet le SceneManager
+ * - Indiquer si une nouvelle frame doit être dessinée
+ * - Signaler sa fin pour que l'écran suivant prenne la fenêtre
+ ************************************************************/
+class Scene {
+public:
+    virtual ~Scene() {}
+
+    // Appelée quand la scène prend la fenêtre (taille, titre, vue)
+    virtual void activate() = 0;
+
+    virtual void handleEvent(const Event& event) = 0;
+
+    // Appelée une fois par tour de boucle, après les événements
+    virtual void advance() {}
+
+    virtual bool needsRedraw() const = 0;
+    virtual void draw() = 0;  // Dessine et affiche une frame
+    virtual bool isFinished() const = 0;
+
+    // Statistiques propres à la scène, affichées à sa fin
+    virtual void printStats() const {}
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef SCENEMANAGER_HPP
+#define SCENEMANAGER_HPP
+
+#include "view/Scene.hpp"
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+/************************************************************
+ * Classe SceneManager
+ * Boucle d'affichage de la fenêtre unique du jeu
+ *
+ * Responsabilités :
+ * - Faire tourner une scène jusqu'à sa fin dans la fenêtre partagée
+ *   (pas de création de fenêtre ni de contexte OpenGL entre les écrans)
+ * - Dormir dans waitEvent tant que la scène n'a rien à redessiner
+ * - Mesurer frames, événements, inactivité et CPU de chaque scène
+ ************************************************************/
+class SceneManager {
+private:
+    RenderWindow& window;
+
+    // Statistiques de la scène en cours
+    unsigned long frameCount;
+    unsigned long eventCount;
+    Time idleTime;
+
+    void dispatch(Scene& scene, const Event& event);
+    void printStats(const Scene& scene, double seconds, double cpuSeconds) const;
+
+public:
+    explicit SceneManager(RenderWindow& window);
+
+    // Retourne quand la scène est finie ou que la fenêtre a été fermée
+    void run(Scene& scene);
+
+    bool isOpen() const { return window.isOpen(); }
+    RenderWindow& getWindow() { return window; }
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef SCRIPTCONSOLE_HPP
+#define SCRIPTCONSOLE_HPP
+
+#include "model/Model.hpp"
+#include <istream>
+#include <ostream>
+
+using namespace std;
+
+/************************************************************
+ * Classe ScriptConsole
+ * Mode non interactif du front-end console
+ *
+ * Responsabilités :
+ * - Lire un flux de commandes compact (fichier ou entrée standard)
+ * - Les appliquer au Model sans afficher de frame intermédiaire
+ * - Produire un bilan : victoire, coups joués et refusés, durée
+ *
+ * Commandes, séparées par des blancs (les '#' commentent la fin de ligne) :
+ *   p X Y   placer la pièce active en (X, Y)
+ *   d N|S|E|O   déplacer la pièce active
+ *   r H|A   rotation horaire ou anti-horaire
+ *   s H|V   symétrie horizontale ou verticale
+ *   c I     choisir la pièce active
+ *   u       annuler le dernier coup
+ *   y       rétablir le coup annulé
+ ************************************************************/
+struct BilanScript {
+    unsigned long commandes;     // Commandes lues
+    unsigned long coupsJoues;    // Commandes acceptées par le modèle
+    unsigned long coupsRefuses;  // Commandes refusées (coup illégal, pièce inconnue ou déjà active)
+    bool victoire;               // Partie gagnée à la fin du script
+    unsigned long coupVictoire;  // Numéro de la commande qui a gagné la partie (0 si aucune)
+    double secondes;
+};
+
+class ScriptConsole {
+private:
+    Model& model;
+
+    bool executerCommande(char commande, istream& entree, unsigned long numero);
+
+public:
+    explicit ScriptConsole(Model& m);
+
+    // Lève runtime_error en cas de commande mal formée (avec son numéro)
+    BilanScript executer(istream& entree);
+
+    static void afficherBilan(ostream& sortie, const BilanScript& bilan);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef TAMPONCONSOLE_HPP
+#define TAMPONCONSOLE_HPP
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum class CouleurConsole { DEFAUT, ROUGE, VERT, JAUNE };
+
+/************************************************************
+ * Classe TamponConsole
+ * Image d'une zone du terminal, caractère par caractère
+ *
+ * Responsabilités :
+ * - Conserver la frame en cours de composition et celle déjà affichée
+ * - Ne produire que les cases modifiées, avec adressage du curseur ANSI
+ * - Tout regrouper dans une seule chaîne, écrite en une fois par l'appelant
+ *
+ * La zone commence au coin haut-gauche de l'écran. Les glyphes sont des
+ * caractères ASCII : une case du tampon = une colonne du terminal.
+ ************************************************************/
+class TamponConsole {
+public:
+    TamponConsole();
+
+    // Change la taille de la zone ; la frame suivante sera complète
+    void redimensionner(int largeur, int hauteur);
+
+    // Remplit la frame en cours d'espaces, avant de la recomposer
+    void vider();
+
+    // Les écritures hors de la zone sont ignorées
+    void ecrire(int x, int y, char glyphe, CouleurConsole couleur = CouleurConsole::DEFAUT);
+    void ecrireTexte(int x, int y, const string& texte, CouleurConsole couleur = CouleurConsole::DEFAUT);
+
+    // L'écran ne correspond plus à la frame affichée (défilement, effacement)
+    void invalider() { complet = true; }
+
+    // Ajoute à 'sortie' de quoi passer de la frame affichée à la frame en cours
+    // Retourne le nombre de cases réécrites
+    size_t rendre(string& sortie);
+
+    int getLargeur() const { return largeur; }
+    int getHauteur() const { return hauteur; }
+
+private:
+    struct Cellule {
+        char glyphe;
+        CouleurConsole couleur;
+
+        bool operator==(const Cellule& autre) const { return glyphe == autre.glyphe && couleur == autre.couleur; }
+        bool operator!=(const Cellule& autre) const { return !(*this == autre); }
+    };
+
+    int largeur;
+    int hauteur;
+    vector<Cellule> courante;  // Frame en cours de composition
+    vector<Cellule> affichee;  // Frame présente à l'écran
+    bool complet;              // Effacer l'écran et tout réécrire au prochain rendu
+};
+
+#endif
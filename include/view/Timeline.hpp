@@ -0,0 +1,54 @@
+#ifndef TIMELINE_HPP
+#define TIMELINE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace sf;
+
+/************************************************************
+ * Classe Timeline
+ * Animations pilotées par l'horloge des frames, sans jamais dormir
+ *
+ * Responsabilités :
+ * - Faire progresser chaque animation de 0 à 1 selon le temps écoulé
+ * - Appeler sa fin une fois la durée atteinte
+ * - Indiquer à la scène qu'il faut redessiner tant qu'une animation tourne
+ *
+ * Chaque animation porte un nom : en relancer une du même nom la remplace.
+ ************************************************************/
+class Timeline {
+public:
+    typedef function<void(float)> Etape;  // Reçoit la progression (0 à 1)
+    typedef function<void()> Fin;
+
+    // Lance (ou remplace) l'animation 'nom' : 'etape' est appelée à chaque frame
+    // après 'delai' secondes, pendant 'duree' secondes, puis 'fin' une fois
+    void start(const string& nom, float duree, Etape etape, Fin fin = Fin(), float delai = 0);
+
+    void cancel(const string& nom);
+    bool isRunning(const string& nom) const;
+    bool isRunning() const { return !animations.empty(); }
+
+    // Fait avancer toutes les animations de 'dt' secondes
+    void advance(float dt);
+
+    // Progression adoucie (départ et arrivée lents)
+    static float easeInOut(float t) { return t * t * (3 - 2 * t); }
+
+private:
+    struct Animation {
+        string nom;
+        float delai;
+        float duree;
+        float ecoule;
+        Etape etape;
+        Fin fin;
+    };
+    vector<Animation> animations;
+};
+
+#endif
@@ -1,27 +1,116 @@
+#include "model/JournalCoups.hpp"
 #include "model/Model.hpp"
+#include "model/NiveauxIntegres.hpp"
 #include "view/ConsoleView.hpp"
+#include "view/ScriptConsole.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
 
-int main() {
+// Modèle de démonstration du mode interactif
+unique_ptr<Model> creerModeleDemo() {
     // Initialisation du modèle
-    Model model(8, 8);
-    
+    unique_ptr<Model> model(new Model(8, 8));
+
     // Création d'une pièce en forme de L
     vector<pair<int, int>> coords_L = {{0,0}, {0,1}, {0,2}, {1,2}};
-    model.ajouterPiece(coords_L);
-    
+    model->ajouterPiece(coords_L);
+
     // Création d'une pièce en forme de T
     vector<pair<int, int>> coords_T = {{0,0}, {1,0}, {2,0}, {1,1}};
-    model.ajouterPiece(coords_T);
-    
+    model->ajouterPiece(coords_T);
+
     // Définir la zone d'arrivée (coin opposé de la grille)
-    model.setZoneArrivee(7, 7);
-    
+    model->setZoneArrivee(7, 7);
+
     // Définir la pièce L comme celle à déplacer vers la zone d'arrivée
-    model.setPieceADeplacer(0);
-    
-    // Création et lancement de la vue console
-    ConsoleView view(model);
-    view.run();
-    
+    model->setPieceADeplacer(0);
+    return model;
+}
+
+int main(int argc, char* argv[]) {
+    // Options :
+    //   --niveau N           jouer le niveau intégré N au lieu de la démonstration
+    //   --script [FICHIER]   mode non interactif (entrée standard si absent ou "-"),
+    //                        code de retour 0 si la partie est gagnée, 2 sinon
+    //   --journal FICHIER    enregistrer les opérations de la partie (avec --niveau)
+    int niveau = 0;
+    bool modeScript = false;
+    string cheminScript = "-";
+    string cheminJournal;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--niveau") == 0 && i + 1 < argc) {
+            niveau = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--script") == 0) {
+            modeScript = true;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                cheminScript = argv[++i];
+            }
+        } else if (strcmp(argv[i], "--journal") == 0 && i + 1 < argc) {
+            cheminJournal = argv[++i];
+        } else {
+            cerr << "Usage : " << argv[0] << " [--niveau N] [--script [FICHIER]] [--journal FICHIER]" << endl;
+            return 1;
+        }
+    }
+
+    // Déclaré avant le Model : il doit lui survivre tant qu'il y est attaché
+    JournalCoups journal(niveau);
+
+    try {
+        if (!cheminJournal.empty() && niveau == 0) {
+            throw invalid_argument("--journal exige --niveau : seuls les niveaux se rejouent");
+        }
+
+        unique_ptr<Model> model;
+        if (niveau != 0) {
+            if (niveau < 1 || niveau > NB_NIVEAUX_INTEGRES) {
+                throw invalid_argument("Niveau inexistant : " + to_string(niveau));
+            }
+            model.reset(new Model(creerNiveauIntegre(niveau)));
+            model->precalculerEspaceConfiguration();
+        } else {
+            model = creerModeleDemo();
+        }
+        if (!cheminJournal.empty()) {
+            model->setJournal(&journal);
+        }
+
+        if (modeScript) {
+            // Lecture rapide : cin n'a pas à rester synchronisé avec stdio
+            ios::sync_with_stdio(false);
+            ScriptConsole script(*model);
+            BilanScript bilan;
+            if (cheminScript == "-") {
+                bilan = script.executer(cin);
+            } else {
+                ifstream fichier(cheminScript.c_str());
+                if (!fichier) {
+                    throw runtime_error("Impossible d'ouvrir le script : " + cheminScript);
+                }
+                bilan = script.executer(fichier);
+            }
+            ScriptConsole::afficherBilan(cout, bilan);
+        } else {
+            // Création et lancement de la vue console
+            ConsoleView view(*model);
+            view.run();
+        }
+
+        if (!cheminJournal.empty()) {
+            model->setJournal(nullptr);
+            journal.ecrire(cheminJournal);
+        }
+        if (modeScript) {
+            return model->isPartieGagnee() ? 0 : 2;
+        }
+    }
+    catch (const exception& e) {
+        cerr << "Erreur : " << e.what() << endl;
+        return 1;
+    }
+
     return 0;
 }
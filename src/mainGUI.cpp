@@ -1,8 +1,20 @@
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <ctime>
 #include <iostream>
 #include <SFML/Graphics.hpp>
+#include "model/JournalCoups.hpp"
 #include "model/Model.hpp"
+#include "model/NiveauPack.hpp"
+#include "model/NiveauxIntegres.hpp"
 #include "model/Observer.hpp"
+#include "model/PreparateurNiveaux.hpp"
+#include "view/CacheVignettes.hpp"
+#include "view/MenuScene.hpp"
+#include "view/SceneManager.hpp"
 #include "view/SFMLView.hpp"
+#include <sys/stat.h>
 
 using namespace std;
 using namespace sf;
@@ -24,39 +36,6 @@ void afficherInstructionsNiveau1() {
     cout << "- Esc : Quitter" << endl;
 }
 
-void configureNiveau1(Model& model) {
-    // Création des pièces
-    vector<pair<int, int>> coords_L = { {0,0}, {0,1}, {0,2}, {1,1} };  // Forme en L
-    model.ajouterPiece(coords_L);
-
-    vector<pair<int, int>> coords_mobile = { {0,0} };  // Pièce mobile
-    model.ajouterPiece(coords_mobile);
-
-    // Placement des pièces
-    model.setPieceActive(0);
-    model.placerPiece(5, 1);
-
-    model.setPieceActive(1);
-    model.placerPiece(6, 6);
-
-    // Store initial positions
-    model.storeInitialPositions();
-
-    // Configuration du niveau
-    model.setZoneArrivee(6, 0);
-    model.setPieceADeplacer(1);
-
-    // Configuration des zones autorisées (chemin vertical)
-    for (int y = 0; y < 8; y++) {
-        model.ajouterZoneAutorisee(6, y);  // Colonne 6 pour le déplacement vertical
-    }
-
-    model.ajouterZoneAutorisee(5, 1);
-    model.ajouterZoneAutorisee(5, 2);
-    model.ajouterZoneAutorisee(5, 3);
-    model.ajouterZoneAutorisee(4, 2);
-}
-
 void afficherInstructionsNiveau2() {
     cout << "Démarrage du jeu Piece Out - Niveau 2" << endl;
     cout << "Objectif : Déplacer la pièce en forme de P jusqu'à la zone but !" << endl;
@@ -73,72 +52,6 @@ void afficherInstructionsNiveau2() {
     cout << "- Esc : Quitter" << endl;
 }
 
-void configureNiveau2(Model& model) {
-    // Création de la pièce selon le schéma ASCII
-    /*
-    0p0
-    ppp
-    */
-    vector<pair<int, int>> coords_piece = {
-        {1,0},      // p du haut
-        {0,1}, {1,1}, {2,1}  // ppp du bas
-    };
-    model.ajouterPiece(coords_piece);
-
-    // Placement de la pièce à sa position initiale
-    model.setPieceActive(0);
-    model.placerPiece(0, 4);  // Position selon le schéma ASCII (le ppp commence à x=0)
-    model.setPieceADeplacer(0);
-
-    // Store initial positions
-    model.storeInitialPositions();
-
-    // Configuration des zones but selon le schéma ASCII
-    /*
-    0rrr0
-    bbbrr  <- zones but en forme de L inversé
-    0b0rr
-    */
-    model.ajouterZoneArrivee(0, 1);  // Premier b (à gauche)
-    model.ajouterZoneArrivee(1, 1);  // Deuxième b
-    model.ajouterZoneArrivee(2, 1);  // Troisième b
-    model.ajouterZoneArrivee(1, 2);  // b du bas
-
-    // Configuration des zones autorisées selon le schéma ASCII
-    /*
-    0rrr0
-    rrrrr
-    0r0rr
-    000rr
-    0r0rr
-    rrrrr
-    0rrr0
-    */
-    // Ajouter toutes les zones autorisées pour chaque ligne
-    for (int x = 0; x < 7; x++) {
-        // Première ligne : 0rrr0
-        if (x >= 1 && x <= 3) model.ajouterZoneAutorisee(x, 0);
-
-        // Deuxième ligne : rrrrr
-        if (x <= 4) model.ajouterZoneAutorisee(x, 1);
-
-        // Troisième ligne : 0r0rr
-        if (x == 1 || (x >= 3 && x <= 4)) model.ajouterZoneAutorisee(x, 2);
-
-        // Quatrième ligne : 000rr
-        if (x >= 3 && x <= 4) model.ajouterZoneAutorisee(x, 3);
-
-        // Cinquième ligne : 0r0rr
-        if (x == 1 || (x >= 3 && x <= 4)) model.ajouterZoneAutorisee(x, 4);
-
-        // Sixième ligne : rrrrr
-        if (x <= 4) model.ajouterZoneAutorisee(x, 5);
-
-        // Dernière ligne : 0rrr0
-        if (x >= 1 && x <= 3) model.ajouterZoneAutorisee(x, 6);
-    }
-}
-
 void afficherInstructionsNiveau3() {
     cout << "Démarrage du jeu Piece Out - Niveau 3" << endl;
     cout << "Objectif : Déplacer la pièce de la zone rouge jusqu'à la zone rose en passant par le labyrinthe !" << endl;
@@ -155,219 +68,168 @@ void afficherInstructionsNiveau3() {
     cout << "- Esc : Quitter" << endl;
 }
 
-void configureNiveau3(Model& model) {
-    // Création de la pièce à déplacer (forme horizontale)
-    vector<pair<int, int>> coords_piece = {
-        {0,0}  // Pièce simple 1x1
-    };
-    model.ajouterPiece(coords_piece);
-
-    // Création de la pièce en L (obstacle)
-    vector<pair<int, int>> coords_L = {
-        {0,0}, {0,1}, {0,2},  // Partie verticale du L (3 cases)
-        {1,2}                 // Partie horizontale du L
-    };
-    model.ajouterPiece(coords_L);
+// Pack de niveaux généré par "make pack" ; à défaut, les niveaux intégrés sont utilisés
+const string CHEMIN_PACK = "resources/niveaux.pack";
 
-    // Placement de la pièce à déplacer
-    model.setPieceActive(0);
-    model.placerPiece(0, 5);  // Position du 'p' dans le schéma
-    model.setPieceADeplacer(0);
+// Un fichier de progression par profil de joueur
+const string REPERTOIRE_PROGRESSION = "progression";
 
-    // Placement de la pièce en L
-    model.setPieceActive(1);
-    model.placerPiece(2, 3);  // Position initiale du L
+// Journaux des parties, un sous-répertoire par profil (rejouables par rejouer_journal)
+const string REPERTOIRE_JOURNAUX = "journaux";
 
-    // Store initial positions
-    model.storeInitialPositions();
+// Vignettes gardées en mémoire par le menu (environ 80 Ko chacune au plus)
+const size_t CAPACITE_VIGNETTES = 128;
 
-    // Configuration des zones autorisées selon le schéma ASCII
-    /*
-    000b0
-    000r0
-    00rrr
-    0rarr  <- 'a' représente la pièce en L
-    00ar0
-    praa0
-    000r0
-    */
-
-    // Configuration de la zone but
-    model.ajouterZoneArrivee(3, 0);  // Position du 'b'
-
-    // Ligne 1 : 000r0
-    model.ajouterZoneAutorisee(3, 0);  // Ajout de la zone but comme zone autorisée
-    model.ajouterZoneAutorisee(3, 1);
-
-    // Ligne 2 : 00rrr
-    model.ajouterZoneAutorisee(2, 2);
-    model.ajouterZoneAutorisee(3, 2);
-    model.ajouterZoneAutorisee(4, 2);
-
-    // Ligne 3 : 0rarr
-    model.ajouterZoneAutorisee(1, 3);
-    model.ajouterZoneAutorisee(2, 3);  // Zone pour la pièce en L
-    model.ajouterZoneAutorisee(3, 3);
-    model.ajouterZoneAutorisee(4, 3);
+// Pack projeté une seule fois, partagé par le menu, ses vignettes et le préparateur
+// (lecture seule, sûre depuis plusieurs threads) ; nul si absent, illisible ou vide
+unique_ptr<LecteurPack> ouvrirPack() {
+    try {
+        unique_ptr<LecteurPack> pack(new LecteurPack(CHEMIN_PACK));
+        if (pack->getNbNiveaux() > 0) {
+            return pack;
+        }
+    }
+    catch (const runtime_error&) {
+        // Pack absent ou illisible : utiliser les niveaux intégrés
+    }
+    return unique_ptr<LecteurPack>();
+}
 
-    // Ligne 4 : 00ar0
-    model.ajouterZoneAutorisee(2, 4);  // Zone pour la pièce en L
-    model.ajouterZoneAutorisee(3, 4);
+unique_ptr<Model> creerModeleNiveau(const LecteurPack* pack, int level) {
+    if (pack && level >= 1 && static_cast<size_t>(level) <= pack->getNbNiveaux()) {
+        return pack->creerModele(level - 1);
+    }
 
-    // Ligne 5 : praa0
-    model.ajouterZoneAutorisee(0, 5);  // Position initiale de la pièce à déplacer
-    model.ajouterZoneAutorisee(1, 5);
-    model.ajouterZoneAutorisee(2, 5);  // Zone pour la pièce en L
-    model.ajouterZoneAutorisee(3, 5);
+    // Même construction que la version console et l'outil de rejeu : mêmes empreintes d'état
+    return unique_ptr<Model>(new Model(creerNiveauIntegre(level)));
+}
 
-    // Ligne 6 : 000r0
-    model.ajouterZoneAutorisee(3, 6);
+Niveau lireNiveau(const LecteurPack* pack, int level) {
+    if (pack && level >= 1 && static_cast<size_t>(level) <= pack->getNbNiveaux()) {
+        return pack->lireNiveau(level - 1);
+    }
+    return creerNiveauIntegre(level);
+}
 
-    // Ajout des zones autorisées pour le mouvement vertical de la pièce en L
-    // La pièce en L occupe 4 cases (3 verticales + 1 horizontale)
-    // Il faut autoriser toutes les positions possibles
-    for (int y = 3; y <= 5; y++) {
-        model.ajouterZoneAutorisee(2, y);     // Pour la partie verticale du L
-        model.ajouterZoneAutorisee(3, y);     // Pour la partie horizontale du L
-        if (y > 0) {
-            model.ajouterZoneAutorisee(2, y - 1);  // Pour la case du haut lors du déplacement
-            model.ajouterZoneAutorisee(3, y - 1);  // Pour la partie horizontale lors du déplacement
-        }
-        if (y < 6) {
-            model.ajouterZoneAutorisee(2, y + 1);  // Pour la case du bas lors du déplacement
-            model.ajouterZoneAutorisee(3, y + 1);  // Pour la partie horizontale lors du déplacement
+// Enregistre le journal de la partie ; un échec n'interrompt pas le jeu
+void enregistrerJournal(const JournalCoups& journal, const string& profil) {
+    if (journal.getNbCoups() == 0) {
+        return;
+    }
+    string repertoire = REPERTOIRE_JOURNAUX + "/" + profil;
+    try {
+        if ((mkdir(REPERTOIRE_JOURNAUX.c_str(), 0755) != 0 && errno != EEXIST)
+            || (mkdir(repertoire.c_str(), 0755) != 0 && errno != EEXIST)) {
+            throw runtime_error("Impossible de créer le répertoire : " + repertoire);
         }
+        string chemin = repertoire + "/niveau_" + to_string(journal.getNiveau()) + "_"
+                      + to_string(static_cast<long>(time(nullptr))) + ".journal";
+        journal.ecrire(chemin);
+        cout << "Journal : " << journal.getNbCoups() << " opérations (" << journal.getTaille()
+             << " octets) dans " << chemin << endl;
+    }
+    catch (const runtime_error& e) {
+        cerr << "Journal non enregistré : " << e.what() << endl;
     }
 }
 
-void runLevel(int level) {
-    Model model(7, 7);
+void runLevel(SceneManager& scenes, PreparateurNiveaux& preparateur, int level, const string& profil) {
+    // Déclaré avant le Model : il doit lui survivre tant qu'il y est attaché
+    JournalCoups journal(level);
+
+    // Le Model a en général été construit en arrière-plan pendant le survol du menu
+    unique_ptr<Model> modele = preparateur.prendre(level);
+    Model& model = *modele;
     string levelTitle = "Piece Out - Niveau " + to_string(level);
     if (Model::isLevelCompleted(level)) {
-        levelTitle += " (Complete)";
+        RecordNiveau record = Model::getProgression().getRecord(level);
+        levelTitle += " (Complete";
+        if (record.coups != 0) {
+            levelTitle += ", record " + to_string(record.coups) + " coups";
+        }
+        levelTitle += ")";
     }
 
     switch (level) {
     case 1:
-        configureNiveau1(model);
         afficherInstructionsNiveau1();
         break;
     case 2:
-        configureNiveau2(model);
         afficherInstructionsNiveau2();
         break;
     case 3:
-        configureNiveau3(model);
         afficherInstructionsNiveau3();
         break;
     }
 
+    model.setJournal(&journal);
     {
-        SFMLView view(model);
+        SFMLView view(model, scenes.getWindow());
         view.setWindowTitle(levelTitle);
-        view.run();
+        chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+        scenes.run(view);
 
         if (model.isPartieGagnee()) {
-            Model::setLevelCompleted(level);
+            long millisecondes = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - debut).count();
+            if (Model::getProgression().enregistrer(level, static_cast<uint32_t>(model.getNbCoups()),
+                                                    static_cast<uint32_t>(max(1L, millisecondes)))) {
+                cout << "Progression enregistrée : niveau " << level << " en " << model.getNbCoups()
+                     << " coups, " << millisecondes / 1000.0 << " s" << endl;
+            }
         }
-    }  // La vue est détruite ici, ce qui ferme la fenêtre
-}
+    }  // La vue est détruite ici, la fenêtre reste ouverte pour le menu
 
-int main() {
-    try {
-        bool running = true;
-        while (running) {
-            // Create menu window
-            RenderWindow menuWindow(VideoMode(800, 600), "Piece Out - Menu");
-            menuWindow.setFramerateLimit(60);
+    model.setJournal(nullptr);
+    enregistrerJournal(journal, profil);
+}
 
-            // Load font
-            Font font;
-            const vector<string> fontPaths = {
-                "resources/arial.ttf",
-                "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
-                "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
-                "/usr/share/fonts/truetype/ubuntu/Ubuntu-R.ttf"
-            };
+int main(int argc, char* argv[]) {
+    // Option : --profil NOM   progression du joueur NOM (par défaut "joueur")
+    string profil = "joueur";
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--profil") == 0 && i + 1 < argc) {
+            profil = argv[++i];
+        } else {
+            cerr << "Usage : " << argv[0] << " [--profil NOM]" << endl;
+            return EXIT_FAILURE;
+        }
+    }
 
-            bool fontLoaded = false;
-            for (const string& path : fontPaths) {
-                if (font.loadFromFile(path)) {
-                    fontLoaded = true;
+    try {
+        // Progression projetée depuis le disque : le menu l'interroge sans la décoder
+        Model::getProgression().ouvrirProfil(REPERTOIRE_PROGRESSION, profil);
+
+        // Une seule fenêtre (et un seul contexte OpenGL) pour le menu et tous les niveaux
+        RenderWindow window(VideoMode(800, 600), "Piece Out - Menu");
+        SceneManager scenes(window);
+
+        unique_ptr<LecteurPack> pack = ouvrirPack();
+        const LecteurPack* source = pack.get();
+        int nbNiveaux = pack ? static_cast<int>(pack->getNbNiveaux()) : NB_NIVEAUX_INTEGRES;
+        PreparateurNiveaux preparateur([source](int level) { return creerModeleNiveau(source, level); });
+
+        // Détruit avant la fenêtre : ses textures appartiennent au contexte OpenGL
+        CacheVignettes vignettes([source](int level) { return lireNiveau(source, level); },
+                                 CAPACITE_VIGNETTES,
+                                 Vector2u(MenuScene::LARGEUR_VIGNETTE, MenuScene::HAUTEUR_VIGNETTE));
+
+        while (scenes.isOpen()) {
+            // Le premier niveau non terminé est le choix le plus probable
+            for (int level = 1; level <= nbNiveaux; ++level) {
+                if (!Model::isLevelCompleted(level)) {
+                    preparateur.preparer(level);
                     break;
                 }
             }
 
-            if (!fontLoaded) {
-                throw runtime_error("Impossible de charger une police");
-            }
-
-            // Create title
-            Text title("Piece Out", font, 48);
-            title.setFillColor(Color::White);
-            title.setPosition(300, 50);
-
-            // Create menu options with completion status
-            vector<Text> menuOptions;
-            vector<string> optionStrings = {
-                string("Niveau 1") + (Model::isLevelCompleted(1) ? " *" : ""),
-                string("Niveau 2") + (Model::isLevelCompleted(2) ? " *" : ""),
-                string("Niveau 3") + (Model::isLevelCompleted(3) ? " *" : ""),
-                "Quitter"
-            };
+            MenuScene menu(window, nbNiveaux, &vignettes,
+                           [&preparateur](int level) { preparateur.preparer(level); });
+            scenes.run(menu);
 
-            for (size_t i = 0; i < optionStrings.size(); ++i) {
-                Text option(optionStrings[i], font, 36);
-                option.setFillColor(Color::White);
-                option.setPosition(350, 200 + i * 80);
-                menuOptions.push_back(option);
+            if (menu.getChoice() == MenuScene::QUITTER || menu.getChoice() == MenuScene::AUCUN_CHOIX) {
+                break;  // "Quitter" ou fenêtre fermée
             }
-
-            while (menuWindow.isOpen()) {
-                Event event;
-                while (menuWindow.pollEvent(event)) {
-                    if (event.type == Event::Closed) {
-                        menuWindow.close();
-                        running = false;
-                    }
-
-                    if (event.type == Event::MouseButtonPressed) {
-                        Vector2i mousePos = Mouse::getPosition(menuWindow);
-
-                        // Check if any option was clicked
-                        for (size_t i = 0; i < menuOptions.size(); ++i) {
-                            if (menuOptions[i].getGlobalBounds().contains(mousePos.x, mousePos.y)) {
-                                menuWindow.close();
-                                if (i < 3) {  // Level options
-                                    runLevel(i + 1);
-                                } else {  // Quit option
-                                    running = false;
-                                }
-                            }
-                        }
-                    }
-
-                    // Highlight option under mouse
-                    Vector2i mousePos = Mouse::getPosition(menuWindow);
-                    for (Text& option : menuOptions) {
-                        if (option.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
-                            option.setFillColor(Color::Yellow);
-                        } else {
-                            option.setFillColor(Color::White);
-                        }
-                    }
-                }
-
-                menuWindow.clear(Color(50, 50, 50));
-                menuWindow.draw(title);
-                for (const Text& option : menuOptions) {
-                    menuWindow.draw(option);
-                }
-                menuWindow.display();
-            }
-
-            // Nettoyer les ressources du menu
-            menuOptions.clear();
+            runLevel(scenes, preparateur, menu.getChoice(), profil);
         }
         return EXIT_SUCCESS;
     }
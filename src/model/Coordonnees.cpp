@@ -0,0 +1,89 @@
+#include "model/Coordonnees.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    bool tientSurUnOctet(int valeur) {
+        return valeur >= INT8_MIN && valeur <= INT8_MAX;
+    }
+}
+
+const size_t Coordonnees::CAPACITE_INTERNE;
+
+Coordonnees::Coordonnees(const vector<pair<int, int>>& cases)
+    : origineX(0), origineY(0), taille(0), externe(false) {
+    for (const pair<int, int>& coord : cases) {
+        push_back(coord);
+    }
+}
+
+void Coordonnees::push_back(const pair<int, int>& coord) {
+    if (!externe) {
+        if (taille == 0) {
+            origineX = coord.first;
+            origineY = coord.second;
+        }
+        int dx = coord.first - origineX;
+        int dy = coord.second - origineY;
+        if (taille < CAPACITE_INTERNE && tientSurUnOctet(dx) && tientSurUnOctet(dy)) {
+            ecarts[2 * taille] = static_cast<int8_t>(dx);
+            ecarts[2 * taille + 1] = static_cast<int8_t>(dy);
+            ++taille;
+            return;
+        }
+        deborder();
+    }
+    debordement.push_back(coord);
+    ++taille;
+}
+
+void Coordonnees::deborder() {
+    debordement.clear();
+    debordement.reserve(taille + 1);
+    for (size_t i = 0; i < taille; ++i) {
+        debordement.push_back((*this)[i]);
+    }
+    externe = true;
+}
+
+void Coordonnees::clear() {
+    taille = 0;
+    externe = false;
+    debordement.clear();
+}
+
+void Coordonnees::translater(int dx, int dy) {
+    if (!externe) {
+        origineX += dx;
+        origineY += dy;
+        return;
+    }
+    for (pair<int, int>& coord : debordement) {
+        coord.first += dx;
+        coord.second += dy;
+    }
+}
+
+vector<pair<int, int>> Coordonnees::versVecteur() const {
+    return vector<pair<int, int>>(begin(), end());
+}
+
+bool Coordonnees::operator==(const Coordonnees& autre) const {
+    if (taille != autre.taille) {
+        return false;
+    }
+    if (!externe && !autre.externe) {
+        return origineX == autre.origineX && origineY == autre.origineY
+            && memcmp(ecarts, autre.ecarts, 2 * taille) == 0;
+    }
+    for (size_t i = 0; i < taille; ++i) {
+        if ((*this)[i] != autre[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Coordonnees::operator<(const Coordonnees& autre) const {
+    return lexicographical_compare(begin(), end(), autre.begin(), autre.end());
+}
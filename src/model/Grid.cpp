@@ -49,7 +49,7 @@ const CellComponent& GridRow::getCellAt(int x) const {
 }
 
 // Grid implementation
-Grid::Grid(int width, int height) : width(width), height(height), rows(height) {
+Grid::Grid(int width, int height) : width(width), height(height), rows(height), messages(&cout) {
     for (int i = 0; i < height; ++i) {
         rows[i] = unique_ptr<GridComponent>(new GridRow(width, i));
     }
@@ -65,7 +65,10 @@ void Grid::accept(GridVisitor& visitor) {
 bool Grid::placePiece(const Piece& piece, int baseX, int baseY) {
     // Vérifier d'abord si la pièce peut être placée
     if (!canPlacePiece(piece, baseX, baseY)) {
-        cout << "Impossible de placer la pièce en (" << baseX << "," << baseY << ") : ";
+        if (!messages) {
+            return false;
+        }
+        *messages << "Impossible de placer la pièce en (" << baseX << "," << baseY << ") : ";
 
         // Vérifier pourquoi le placement est impossible
         for (const pair<int, int>& coord : piece.getCoordinates()) {
@@ -73,7 +76,7 @@ bool Grid::placePiece(const Piece& piece, int baseX, int baseY) {
             int y = baseY + coord.second;
 
             if (x < 0 || x >= width || y < 0 || y >= height) {
-                cout << "coordonnées (" << x << "," << y << ") hors limites" << endl;
+                *messages << "coordonnées (" << x << "," << y << ") hors limites" << endl;
                 return false;
             }
 
@@ -81,12 +84,12 @@ bool Grid::placePiece(const Piece& piece, int baseX, int baseY) {
                 const GridRow& row = static_cast<const GridRow&>(*rows[y]);
                 const CellComponent& cellComponent = row.getCellAt(x);
                 if (cellComponent.getCell().isOccupied()) {
-                    cout << "position (" << x << "," << y << ") déjà occupée" << endl;
+                    *messages << "position (" << x << "," << y << ") déjà occupée" << endl;
                     return false;
                 }
             }
             catch (const out_of_range&) {
-                cout << "position (" << x << "," << y << ") invalide" << endl;
+                *messages << "position (" << x << "," << y << ") invalide" << endl;
                 return false;
             }
         }
@@ -103,7 +106,9 @@ bool Grid::placePiece(const Piece& piece, int baseX, int baseY) {
             cellComponent.getCell().setOccupant(const_cast<Piece*>(&piece));
         }
         catch (const out_of_range&) {
-            cout << "Erreur inattendue lors du placement de la pièce" << endl;
+            if (messages) {
+                *messages << "Erreur inattendue lors du placement de la pièce" << endl;
+            }
             return false;
         }
     }
@@ -136,6 +141,31 @@ bool Grid::canPlacePiece(const Piece& piece, int baseX, int baseY) const {
     return true;
 }
 
+void Grid::retirerPiece(const Piece& piece, int baseX, int baseY) {
+    // Seules les cases de son empreinte sont touchées, sans reconstruire la grille
+    for (const pair<int, int>& coord : piece.getCoordinates()) {
+        int x = baseX + coord.first;
+        int y = baseY + coord.second;
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            continue;
+        }
+        GridRow& row = static_cast<GridRow&>(*rows[y]);
+        Cell& cell = row.getCellAt(x).getCell();
+        if (cell.getOccupant() == &piece) {
+            cell.removeOccupant();
+        }
+    }
+    notifyObservers();
+}
+
+const Piece* Grid::getOccupant(int x, int y) const {
+    if (x < 0 || x >= width || y < 0 || y >= height) {
+        return nullptr;
+    }
+    const GridRow& row = static_cast<const GridRow&>(*rows[y]);
+    return row.getCellAt(x).getCell().getOccupant();
+}
+
 void Grid::clear() {
     for (unique_ptr<GridComponent>& row : rows) {
         try {
@@ -169,6 +199,10 @@ void Grid::afficher(ostream& os) const {
     }
 }
 
+void Grid::setSortieMessages(ostream* sortie) {
+    messages = sortie;
+}
+
 Grid::~Grid() {
     // Nettoyer les lignes
     rows.clear();
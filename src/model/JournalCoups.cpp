@@ -0,0 +1,311 @@
+#include "model/JournalCoups.hpp"
+#include "model/Model.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+namespace {
+    const char MAGIC[4] = { 'P', 'C', 'J', 'R' };
+    const uint16_t VERSION = 1;
+    const size_t TAILLE_EN_TETE = 36;
+
+    void ecrireU32(vector<uint8_t>& sortie, uint32_t valeur) {
+        for (int i = 0; i < 4; ++i) {
+            sortie.push_back(static_cast<uint8_t>((valeur >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void ecrireU64(vector<uint8_t>& sortie, uint64_t valeur) {
+        ecrireU32(sortie, static_cast<uint32_t>(valeur));
+        ecrireU32(sortie, static_cast<uint32_t>(valeur >> 32));
+    }
+
+    uint32_t lireU32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+             | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    uint64_t lireU64(const uint8_t* p) {
+        return static_cast<uint64_t>(lireU32(p)) | (static_cast<uint64_t>(lireU32(p + 4)) << 32);
+    }
+
+    // Entier non signé sur 7 bits par octet, bit de poids fort = octet suivant
+    void ecrireVarint(vector<uint8_t>& sortie, uint32_t valeur) {
+        while (valeur >= 0x80) {
+            sortie.push_back(static_cast<uint8_t>(valeur | 0x80));
+            valeur >>= 7;
+        }
+        sortie.push_back(static_cast<uint8_t>(valeur));
+    }
+
+    uint32_t lireVarint(const uint8_t*& p, const uint8_t* fin) {
+        uint32_t valeur = 0;
+        for (int decalage = 0; decalage < 35; decalage += 7) {
+            if (p == fin) {
+                throw runtime_error("Journal tronqué");
+            }
+            uint8_t octet = *p++;
+            valeur |= static_cast<uint32_t>(octet & 0x7F) << decalage;
+            if (!(octet & 0x80)) {
+                return valeur;
+            }
+        }
+        throw runtime_error("Entier invalide dans le journal");
+    }
+
+    // Petits écarts signés sur peu d'octets : 0, -1, 1, -2... deviennent 0, 1, 2, 3...
+    uint32_t zigzag(int valeur) {
+        return (static_cast<uint32_t>(valeur) << 1) ^ static_cast<uint32_t>(valeur >> 31);
+    }
+
+    int dezigzag(uint32_t valeur) {
+        return static_cast<int>(valeur >> 1) ^ -static_cast<int>(valeur & 1);
+    }
+
+    [[noreturn]] void divergence(size_t numero, const string& message) {
+        throw runtime_error("Opération " + to_string(numero) + " du journal : " + message);
+    }
+}
+
+JournalCoups::JournalCoups(int n)
+    : niveau(static_cast<uint32_t>(n)),
+    nbCoups(0),
+    empreinteInitiale(0),
+    empreinteFinale(0),
+    debut(chrono::steady_clock::now()),
+    dernierTemps(0) {}
+
+void JournalCoups::commencer(uint64_t empreinte) {
+    octets.clear();
+    nbCoups = 0;
+    empreinteInitiale = empreinte;
+    empreinteFinale = empreinte;
+    debut = chrono::steady_clock::now();
+    dernierTemps = 0;
+}
+
+void JournalCoups::terminer(uint64_t empreinte) {
+    empreinteFinale = empreinte;
+}
+
+void JournalCoups::noter(TypeOperation type, uint8_t parametre) {
+    uint32_t temps = static_cast<uint32_t>(
+        chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - debut).count());
+    ecrireVarint(octets, temps - dernierTemps);
+    dernierTemps = temps;
+    octets.push_back(static_cast<uint8_t>((static_cast<uint8_t>(type) << 5) | (parametre & 0x1F)));
+    ++nbCoups;
+}
+
+void JournalCoups::noterPlacement(const pair<int, int>& avant, const pair<int, int>& apres, bool reussi) {
+    noter(TypeOperation::PLACEMENT, reussi ? 1 : 0);
+    ecrireVarint(octets, zigzag(apres.first - avant.first));
+    ecrireVarint(octets, zigzag(apres.second - avant.second));
+}
+
+void JournalCoups::noterDeplacement(OrientationDeplacement direction) {
+    noter(TypeOperation::DEPLACEMENT, static_cast<uint8_t>(direction));
+}
+
+void JournalCoups::noterTranslation(int dx, int dy, unsigned long nbPas) {
+    noter(TypeOperation::DEPLACEMENT, TRANSLATION);
+    ecrireVarint(octets, zigzag(dx));
+    ecrireVarint(octets, zigzag(dy));
+    ecrireVarint(octets, static_cast<uint32_t>(nbPas));
+}
+
+void JournalCoups::noterRotation(OrientationRotation sens) {
+    noter(TypeOperation::ROTATION, static_cast<uint8_t>(sens));
+}
+
+void JournalCoups::noterSymetrie(OrientationSymetrie sens) {
+    noter(TypeOperation::SYMETRIE, static_cast<uint8_t>(sens));
+}
+
+void JournalCoups::noterSelection(size_t index) {
+    if (index < SELECTION_ETENDUE) {
+        noter(TypeOperation::SELECTION, static_cast<uint8_t>(index));
+    } else {
+        noter(TypeOperation::SELECTION, SELECTION_ETENDUE);
+        ecrireVarint(octets, static_cast<uint32_t>(index));
+    }
+}
+
+void JournalCoups::noterReinitialisation() {
+    noter(TypeOperation::REINITIALISATION, POSITION_INITIALE);
+}
+
+void JournalCoups::noterInstantane(uint32_t numero) {
+    noter(TypeOperation::REINITIALISATION, INSTANTANE_PRIS);
+    ecrireVarint(octets, numero);
+}
+
+void JournalCoups::noterRestauration(uint32_t numero) {
+    noter(TypeOperation::REINITIALISATION, INSTANTANE_RESTAURE);
+    ecrireVarint(octets, numero);
+}
+
+void JournalCoups::noterAnnulation() {
+    noter(TypeOperation::ANNULATION, 0);
+}
+
+void JournalCoups::noterRetablissement() {
+    noter(TypeOperation::RETABLISSEMENT, 0);
+}
+
+void JournalCoups::ecrire(const string& chemin) const {
+    vector<uint8_t> sortie(MAGIC, MAGIC + 4);
+    sortie.push_back(static_cast<uint8_t>(VERSION & 0xFF));
+    sortie.push_back(static_cast<uint8_t>(VERSION >> 8));
+    sortie.push_back(0);
+    sortie.push_back(0);
+    ecrireU32(sortie, niveau);
+    ecrireU32(sortie, nbCoups);
+    ecrireU32(sortie, static_cast<uint32_t>(octets.size()));
+    ecrireU64(sortie, empreinteInitiale);
+    ecrireU64(sortie, empreinteFinale);
+    sortie.insert(sortie.end(), octets.begin(), octets.end());
+
+    // Écrire à côté puis renommer pour ne jamais laisser de journal tronqué
+    string temporaire = chemin + ".tmp";
+    {
+        ofstream fichier(temporaire.c_str(), ios::binary | ios::trunc);
+        if (!fichier) {
+            throw runtime_error("Impossible de créer le journal : " + temporaire);
+        }
+        fichier.write(reinterpret_cast<const char*>(sortie.data()), sortie.size());
+        if (!fichier) {
+            throw runtime_error("Erreur d'écriture du journal : " + temporaire);
+        }
+    }
+    if (rename(temporaire.c_str(), chemin.c_str()) != 0) {
+        remove(temporaire.c_str());
+        throw runtime_error("Impossible de renommer le journal : " + chemin);
+    }
+}
+
+JournalCoups JournalCoups::lire(const string& chemin) {
+    ifstream fichier(chemin.c_str(), ios::binary);
+    if (!fichier) {
+        throw runtime_error("Impossible d'ouvrir le journal : " + chemin);
+    }
+    vector<uint8_t> contenu((istreambuf_iterator<char>(fichier)), istreambuf_iterator<char>());
+
+    bool valide = contenu.size() >= TAILLE_EN_TETE
+               && equal(MAGIC, MAGIC + 4, contenu.begin())
+               && (contenu[4] | (contenu[5] << 8)) == VERSION
+               && contenu.size() - TAILLE_EN_TETE == lireU32(&contenu[16]);
+    if (!valide) {
+        throw runtime_error("Journal invalide : " + chemin);
+    }
+
+    JournalCoups journal(static_cast<int>(lireU32(&contenu[8])));
+    journal.nbCoups = lireU32(&contenu[12]);
+    journal.empreinteInitiale = lireU64(&contenu[20]);
+    journal.empreinteFinale = lireU64(&contenu[28]);
+    journal.octets.assign(contenu.begin() + TAILLE_EN_TETE, contenu.end());
+    return journal;
+}
+
+BilanRejeu JournalCoups::rejouer(Model& model) const {
+    if (model.getEmpreinte() != empreinteInitiale) {
+        throw runtime_error("L'état initial du niveau ne correspond pas au journal");
+    }
+    BilanRejeu bilan = {0, false, 0};
+    chrono::steady_clock::time_point depart = chrono::steady_clock::now();
+
+    const uint8_t* p = octets.data();
+    const uint8_t* fin = p + octets.size();
+    map<uint32_t, Model::Instantane> instantanes;  // Par numéro d'enregistrement
+    for (size_t numero = 1; numero <= nbCoups; ++numero) {
+        lireVarint(p, fin);  // Délai : le rejeu va aussi vite que possible
+        if (p == fin) {
+            throw runtime_error("Journal tronqué");
+        }
+        uint8_t type = *p >> 5;
+        uint8_t parametre = *p & 0x1F;
+        ++p;
+
+        switch (static_cast<TypeOperation>(type)) {
+        case TypeOperation::PLACEMENT: {
+            int dx = dezigzag(lireVarint(p, fin));
+            int dy = dezigzag(lireVarint(p, fin));
+            pair<int, int> position = model.getPosition(model.getPieceActiveIndex());
+            if (model.placerPiece(position.first + dx, position.second + dy) != (parametre == 1)) {
+                divergence(numero, "la pose ne donne plus le même résultat");
+            }
+            break;
+        }
+        case TypeOperation::DEPLACEMENT:
+            if (parametre == TRANSLATION) {
+                int dx = dezigzag(lireVarint(p, fin));
+                int dy = dezigzag(lireVarint(p, fin));
+                if (!model.translaterPiece(dx, dy, lireVarint(p, fin))) {
+                    divergence(numero, "translation refusée");
+                }
+            } else if (parametre > static_cast<uint8_t>(OrientationDeplacement::OUEST)
+                       || !model.deplacerPiece(static_cast<OrientationDeplacement>(parametre))) {
+                divergence(numero, "déplacement refusé");
+            }
+            break;
+        case TypeOperation::ROTATION:
+            if (parametre > static_cast<uint8_t>(OrientationRotation::ANTIHORAIRE)
+                || !model.rotationPiece(static_cast<OrientationRotation>(parametre))) {
+                divergence(numero, "rotation refusée");
+            }
+            break;
+        case TypeOperation::SYMETRIE:
+            if (parametre > static_cast<uint8_t>(OrientationSymetrie::VERTICALE)
+                || !model.symetriePiece(static_cast<OrientationSymetrie>(parametre))) {
+                divergence(numero, "symétrie refusée");
+            }
+            break;
+        case TypeOperation::SELECTION: {
+            size_t index = (parametre < SELECTION_ETENDUE) ? parametre : lireVarint(p, fin);
+            if (index >= model.getNbPieces()) {
+                divergence(numero, "pièce inexistante");
+            }
+            model.setPieceActive(index);
+            break;
+        }
+        case TypeOperation::REINITIALISATION:
+            if (parametre == POSITION_INITIALE) {
+                model.resetToInitialPositions();
+            } else if (parametre == INSTANTANE_PRIS) {
+                uint32_t numeroInstantane = lireVarint(p, fin);
+                instantanes[numeroInstantane] = model.prendreInstantane();
+            } else if (parametre == INSTANTANE_RESTAURE) {
+                map<uint32_t, Model::Instantane>::const_iterator it = instantanes.find(lireVarint(p, fin));
+                if (it == instantanes.end()) {
+                    divergence(numero, "instantané inconnu");
+                }
+                model.restaurer(it->second);
+            } else {
+                divergence(numero, "réinitialisation inconnue");
+            }
+            break;
+        case TypeOperation::ANNULATION:
+            if (!model.annuler()) {
+                divergence(numero, "rien à annuler");
+            }
+            break;
+        case TypeOperation::RETABLISSEMENT:
+            if (!model.retablir()) {
+                divergence(numero, "rien à rétablir");
+            }
+            break;
+        default:
+            divergence(numero, "type d'opération inconnu");
+        }
+        ++bilan.coups;
+    }
+    if (p != fin) {
+        throw runtime_error("Octets en trop à la fin du journal");
+    }
+
+    bilan.empreinteValide = (model.getEmpreinte() == empreinteFinale);
+    bilan.secondes = chrono::duration<double>(chrono::steady_clock::now() - depart).count();
+    return bilan;
+}
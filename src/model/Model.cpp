@@ -1,10 +1,16 @@
 #include "model/Model.hpp"
 #include "model/Piece.hpp"
+#include <algorithm>
 #include <climits>
 #include <iostream>
 
+namespace {
+    // Environ 40 octets par entrée : quelques Mo au plus pour une très longue session
+    const size_t LIMITE_HISTORIQUE_DEFAUT = 100000;
+}
+
 // Initialize static member
-vector<bool> Model::completedLevels(3, false);  // 3 levels, all initially not completed
+ProgressionNiveaux Model::progression;  // Agrandie à la demande par setLevelCompleted
 
 Model::Model(int w, int h) :
     grid(w, h),
@@ -13,20 +19,59 @@ Model::Model(int w, int h) :
     piecesPosees(),
     pieceActive(0),
     pieceADeplacer(0),
+    orientationBut(OrientationBut::LIBRE),
     width(w),
-    height(h) {
+    height(h),
+    espaceConfigurationValide(false),
+    decalageAtteignabilite(0, 0),
+    atteignabiliteValide(false),
+    revisionZones(0),
+    nbCoups(0),
+    journal(nullptr),
+    messages(&cout),
+    curseurHistorique(0),
+    limiteHistorique(LIMITE_HISTORIQUE_DEFAUT),
+    generationPieces(0),
+    prochainInstantane(0),
+    dernierEtatPerime(true) {
     grid.addObserver(this);
 }
 
+Model::Model(const Niveau& niveau) :
+    grid(niveau.largeur, niveau.hauteur),
+    pieces(),
+    positions(),
+    piecesPosees(),
+    pieceActive(0),
+    pieceADeplacer(0),
+    orientationBut(OrientationBut::LIBRE),
+    width(niveau.largeur),
+    height(niveau.hauteur),
+    espaceConfigurationValide(false),
+    decalageAtteignabilite(0, 0),
+    atteignabiliteValide(false),
+    revisionZones(0),
+    nbCoups(0),
+    journal(nullptr),
+    messages(&cout),
+    curseurHistorique(0),
+    limiteHistorique(LIMITE_HISTORIQUE_DEFAUT),
+    generationPieces(0),
+    prochainInstantane(0),
+    dernierEtatPerime(true) {
+    grid.addObserver(this);
+    chargerNiveau(niveau);
+}
+
 Model::~Model() {
+    setJournal(nullptr);
+
     // Se retirer comme observateur de la grille
     grid.removeObserver(this);
 
     // Nettoyer les ressources
     pieces.clear();
     positions.clear();
-    initialPositions.clear();
-    initialCoordinates.clear();
     piecesPosees.clear();
     zonesArrivee.clear();
     zonesAutorisees.clear();
@@ -35,16 +80,133 @@ Model::~Model() {
     removeAllObservers();
 }
 
+// Chargement d'un niveau complet
+void Model::chargerNiveau(const Niveau& niveau) {
+    if (niveau.largeur != width || niveau.hauteur != height) {
+        throw invalid_argument("Dimensions du niveau incompatibles avec la grille");
+    }
+    size_t nbCellules = static_cast<size_t>(width) * height;
+    if (niveau.positions.size() != niveau.pieces.size() || niveau.posees.size() != niveau.pieces.size() ||
+        niveau.pieceADeplacer >= niveau.pieces.size() ||
+        niveau.zonesAutorisees.size() != nbCellules || niveau.zonesArrivee.size() != nbCellules) {
+        throw invalid_argument("Description de niveau incohérente");
+    }
+
+    pieces.clear();
+    pieces.reserve(niveau.pieces.size());
+    for (const vector<pair<int, int>>& coords : niveau.pieces) {
+        pieces.push_back(PieceConcrete(coords));
+    }
+    positions = niveau.positions;
+    remplacerPieces();
+    piecesPosees = niveau.posees;
+
+    // Les bitmaps sont parcourus dans l'ordre du set (x puis y) pour insérer en fin
+    zonesAutorisees.clear();
+    zonesArrivee.clear();
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) {
+            if (niveau.zonesAutorisees[y * width + x]) {
+                zonesAutorisees.insert(zonesAutorisees.end(), make_pair(x, y));
+            }
+            if (niveau.zonesArrivee[y * width + x]) {
+                zonesArrivee.insert(zonesArrivee.end(), make_pair(x, y));
+            }
+        }
+    }
+
+    pieceADeplacer = niveau.pieceADeplacer;
+    orientationBut = niveau.orientationBut;
+    pieceActive = pieceADeplacer;
+    espaceConfigurationValide = false;
+    atteignabiliteValide = false;
+    ++revisionZones;
+
+    redessinerGrille(false);
+    storeInitialPositions();
+    precalculerEspaceConfiguration();
+    notifyObservers();
+}
+
+Niveau Model::extraireNiveau() const {
+    Niveau niveau(width, height);
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        niveau.pieces.push_back(pieces[i].getCoordinates().versVecteur());
+        niveau.positions.push_back(piecesPosees[i] ? positions[i] : make_pair(-1, -1));
+        niveau.posees.push_back(piecesPosees[i]);
+    }
+    for (const pair<int, int>& zone : zonesAutorisees) {
+        if (zone.first >= 0 && zone.first < width && zone.second >= 0 && zone.second < height) {
+            niveau.zonesAutorisees[zone.second * width + zone.first] = true;
+        }
+    }
+    for (const pair<int, int>& zone : zonesArrivee) {
+        if (zone.first >= 0 && zone.first < width && zone.second >= 0 && zone.second < height) {
+            niveau.zonesArrivee[zone.second * width + zone.first] = true;
+        }
+    }
+    niveau.pieceADeplacer = pieceADeplacer;
+    niveau.orientationBut = orientationBut;
+    return niveau;
+}
+
+// Enregistrement des opérations
+void Model::setJournal(JournalCoups* nouveau) {
+    if (journal) {
+        journal->terminer(getEmpreinte());
+    }
+    journal = nouveau;
+    if (journal) {
+        journal->commencer(getEmpreinte());
+    }
+}
+
+void Model::setSortieMessages(ostream* sortie) {
+    messages = sortie;
+    grid.setSortieMessages(sortie);
+}
+
+uint64_t Model::getEmpreinte() const {
+    uint64_t empreinte = 14695981039346656037ull;
+    auto melanger = [&empreinte](int64_t valeur) {
+        for (int i = 0; i < 8; ++i) {
+            empreinte ^= static_cast<uint64_t>(valeur >> (8 * i)) & 0xFF;
+            empreinte *= 1099511628211ull;
+        }
+    };
+
+    melanger(static_cast<int64_t>(pieceActive));
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        melanger(piecesPosees[i] ? 1 : 0);
+        melanger(positions[i].first);
+        melanger(positions[i].second);
+        const Coordonnees& coords = pieces[i].getCoordinates();
+        melanger(static_cast<int64_t>(coords.size()));
+        for (const pair<int, int>& coord : coords) {
+            melanger(coord.first);
+            melanger(coord.second);
+        }
+    }
+    return empreinte;
+}
+
 // Gestion des pièces
 void Model::ajouterPiece(const vector<pair<int, int>>& coords) {
     pieces.push_back(PieceConcrete(coords));
     positions.push_back(make_pair(-1, -1));
     piecesPosees.push_back(false);
+    remplacerPieces();
+    espaceConfigurationValide = false;
+    atteignabiliteValide = false;
+    redessinerGrille(false);  // Le vecteur de pièces a pu être réalloué
     notifyObservers();
 }
 
 void Model::setPieceActive(size_t index) {
     if (index < pieces.size()) {
+        if (journal && index != pieceActive) {
+            journal->noterSelection(index);
+        }
         pieceActive = index;
         // Pas besoin de notifier car pas de changement visuel
     }
@@ -65,7 +227,7 @@ size_t Model::getNbPieces() const {
     return pieces.size();
 }
 
-const vector<pair<int, int>>& Model::getPieceCoords(size_t index) const {
+const Coordonnees& Model::getPieceCoords(size_t index) const {
     if (index >= pieces.size()) {
         throw runtime_error("Index de pièce invalide");
     }
@@ -90,7 +252,7 @@ pair<int, int> Model::getPosition(size_t index) const {
 bool Model::verifierCollision(int x, int y, size_t pieceIndex) const {
     for (size_t i = 0; i < pieces.size(); ++i) {
         if (i != pieceIndex && piecesPosees[i]) {
-            const vector<pair<int, int>>& coords = pieces[i].getCoordinates();
+            const Coordonnees& coords = pieces[i].getCoordinates();
             for (const pair<int, int>& coord : coords) {
                 int px = positions[i].first + coord.first;
                 int py = positions[i].second + coord.second;
@@ -118,7 +280,11 @@ bool Model::placerPiece(int x, int y) {
     }
 
     // Sauvegarder la nouvelle position
+    pair<int, int> ancienne = positions[pieceActive];
+    bool poseeAvant = piecesPosees[pieceActive];
     positions[pieceActive] = make_pair(x, y);
+    atteignabiliteValide = false;
+    noterModification(pieceActive);
 
     // Essayer de placer la pièce
     grid.clear();  // Nettoyer la grille
@@ -130,18 +296,27 @@ bool Model::placerPiece(int x, int y) {
 
     if (grid.placePiece(pieces[pieceActive], x, y)) {
         piecesPosees[pieceActive] = true;
-
-        // Vérifier la victoire après chaque placement
-        if (pieceActive == pieceADeplacer && verifierVictoire()) {
-            cout << "🎉 Félicitations ! Vous avez gagné !" << endl;
+        ++nbCoups;
+        historiser(pieceActive, ancienne, poseeAvant, pieces[pieceActive], 1);
+        if (journal) {
+            journal->noterPlacement(ancienne, positions[pieceActive], true);
         }
 
+        // Vérifier la victoire après chaque placement
+        annoncerVictoire();
+        notifyObservers();
         return true;
     }
 
-    // Si échec, réinitialiser la position
+    // Si échec, réinitialiser la position (la pièce est retirée : le journal le note aussi)
     positions[pieceActive] = make_pair(-1, -1);
     piecesPosees[pieceActive] = false;
+    if (poseeAvant || ancienne != positions[pieceActive]) {
+        historiser(pieceActive, ancienne, poseeAvant, pieces[pieceActive], 0);
+    }
+    if (journal) {
+        journal->noterPlacement(ancienne, make_pair(x, y), false);
+    }
     redessinerGrille(true);
     return false;
 }
@@ -167,38 +342,29 @@ bool Model::appliquerTransformation(PieceOperateur& operateur) {
         // Appliquer la transformation en utilisant le Visitor
         pieces[pieceActive].accept(operateur);
 
-        // Vérifier si la transformation est valide
-        if (!verifierTransformation()) {
+        // Partie statique : la nouvelle empreinte doit être dans la grille et les zones autorisées
+        if (!estPlacementStatiqueValide(pieceActive, pieces[pieceActive], positions[pieceActive])) {
             pieces[pieceActive] = pieceOriginale;
             positions[pieceActive] = positionOriginale;
-            redessinerGrille(true);
             return false;
         }
 
-        // Vérifier si la nouvelle position est dans une zone autorisée
-        bool positionValide = true;
-        for (const pair<int, int>& coord : pieces[pieceActive].getCoordinates()) {
-            int newX = positions[pieceActive].first + coord.first;
-            int newY = positions[pieceActive].second + coord.second;
-            if (!estZoneAutorisee(newX, newY)) {
-                positionValide = false;
-                break;
-            }
-        }
-
-        if (!positionValide) {
+        // Partie dynamique : collisions avec les autres pièces
+        if (!verifierTransformation()) {
             pieces[pieceActive] = pieceOriginale;
             positions[pieceActive] = positionOriginale;
             redessinerGrille(true);
             return false;
         }
 
+        atteignabiliteValide = false;
+
         // Vérifier la victoire après la transformation
-        if (pieceActive == pieceADeplacer && verifierVictoire()) {
-            cout << "🎉 Félicitations ! Vous avez gagné !" << endl;
-            setLevelCompleted(1);  // Marquer le niveau comme complété
-        }
+        annoncerVictoire();
 
+        ++nbCoups;
+        noterModification(pieceActive);
+        historiser(pieceActive, positionOriginale, true, pieceOriginale, 1);
         notifyObservers();
         return true;
     }
@@ -221,7 +387,74 @@ bool Model::deplacerPiece(OrientationDeplacement direction) {
     OperateurDeplacement deplacement(pieces[pieceActive], positions[pieceActive], direction);
     
     // Utiliser la méthode appliquerTransformation
-    return appliquerTransformation(deplacement);
+    if (!appliquerTransformation(deplacement)) {
+        return false;
+    }
+    if (journal) {
+        journal->noterDeplacement(direction);
+    }
+    return true;
+}
+
+bool Model::translaterPiece(const vector<OrientationDeplacement>& pas) {
+    if (pieces.empty() || pieceActive >= pieces.size() || !piecesPosees[pieceActive]) {
+        return false;
+    }
+
+    // Valider chaque pas sur la grille courante, sans la modifier ni recopier son occupation
+    const Coordonnees& coords = pieces[pieceActive].getCoordinates();
+    pair<int, int> position = positions[pieceActive];
+    unsigned long pasJoues = 0;
+    for (OrientationDeplacement direction : pas) {
+        pair<int, int> suivante = position;
+        switch (direction) {
+        case OrientationDeplacement::NORD:  suivante.second--; break;
+        case OrientationDeplacement::SUD:   suivante.second++; break;
+        case OrientationDeplacement::OUEST: suivante.first--;  break;
+        case OrientationDeplacement::EST:   suivante.first++;  break;
+        }
+        if (estPlacementStatiqueValide(pieceActive, pieces[pieceActive], suivante)
+            && estEmpreinteLibre(pieceActive, coords, suivante)) {
+            position = suivante;
+            ++pasJoues;
+        }
+    }
+
+    // Un seul déplacement pour l'écart net, mais chaque pas compte comme un coup
+    return translaterPiece(position.first - positions[pieceActive].first,
+                           position.second - positions[pieceActive].second, pasJoues);
+}
+
+bool Model::translaterPiece(int dx, int dy, unsigned long nbPas) {
+    if (pieces.empty() || pieceActive >= pieces.size() || !piecesPosees[pieceActive]
+        || (dx == 0 && dy == 0) || nbPas == 0) {
+        return false;
+    }
+
+    const Coordonnees& coords = pieces[pieceActive].getCoordinates();
+    pair<int, int> ancienne = positions[pieceActive];
+    pair<int, int> destination(ancienne.first + dx, ancienne.second + dy);
+    if (!estPlacementStatiqueValide(pieceActive, pieces[pieceActive], destination)
+        || !estEmpreinteLibre(pieceActive, coords, destination)) {
+        return false;
+    }
+
+    // Seule la pièce active change de cases : inutile de reconstruire toute la grille
+    grid.retirerPiece(pieces[pieceActive], ancienne.first, ancienne.second);
+    positions[pieceActive] = destination;
+    grid.placePiece(pieces[pieceActive], destination.first, destination.second);
+    atteignabiliteValide = false;
+    noterModification(pieceActive);
+
+    nbCoups += nbPas;
+    historiser(pieceActive, ancienne, true, pieces[pieceActive], static_cast<long>(nbPas));
+    if (journal) {
+        journal->noterTranslation(dx, dy, nbPas);
+    }
+
+    annoncerVictoire();
+    notifyObservers();
+    return true;
 }
 
 bool Model::symetriePiece(OrientationSymetrie sens) {
@@ -233,7 +466,13 @@ bool Model::symetriePiece(OrientationSymetrie sens) {
     OperateurSymetrie symetrie(pieces[pieceActive], positions[pieceActive], sens);
     
     // Utiliser la méthode appliquerTransformation
-    return appliquerTransformation(symetrie);
+    if (!appliquerTransformation(symetrie)) {
+        return false;
+    }
+    if (journal) {
+        journal->noterSymetrie(sens);
+    }
+    return true;
 }
 
 bool Model::rotationPiece(OrientationRotation sens) {
@@ -245,7 +484,760 @@ bool Model::rotationPiece(OrientationRotation sens) {
     OperateurRotation rotation(pieces[pieceActive], positions[pieceActive], sens);
     
     // Utiliser la méthode appliquerTransformation
-    return appliquerTransformation(rotation);
+    if (!appliquerTransformation(rotation)) {
+        return false;
+    }
+    if (journal) {
+        journal->noterRotation(sens);
+    }
+    return true;
+}
+
+// Historique d'annulation
+uint32_t Model::indexerForme(const Coordonnees& coords, pair<int, int>& decalage) {
+    // Une pièce déplacée garde sa forme : seul le décalage change, sans nouvelle entrée
+    decalage = coords.empty() ? make_pair(0, 0) : coords[0];
+    Coordonnees forme = coords;
+    forme.translater(-decalage.first, -decalage.second);
+    map<Coordonnees, uint32_t>::const_iterator it = indexFormes.find(forme);
+    if (it != indexFormes.end()) {
+        return it->second;
+    }
+    uint32_t index = static_cast<uint32_t>(formesHistorique.size());
+    formesHistorique.push_back(forme);
+    indexFormes.insert(make_pair(forme, index));
+    return index;
+}
+
+Coordonnees Model::formeHistorique(uint32_t forme, const pair<int, int>& decalage) const {
+    Coordonnees coords = formesHistorique[forme];
+    coords.translater(decalage.first, decalage.second);
+    return coords;
+}
+
+void Model::historiser(size_t index, const pair<int, int>& avant, bool poseeAvant,
+                       const PieceConcrete& pieceAvant, long coups, bool suiteGroupe) {
+    Modification modification;
+    modification.piece = static_cast<uint32_t>(index);
+    modification.formeApres = indexerForme(pieces[index].getCoordinates(), modification.decalageApres);
+    modification.formeAvant = modification.formeApres;
+    modification.decalageAvant = modification.decalageApres;
+    if (pieceAvant.getCoordinates() != pieces[index].getCoordinates()) {
+        modification.formeAvant = indexerForme(pieceAvant.getCoordinates(), modification.decalageAvant);
+    }
+    modification.orientationAvant = pieceAvant.getOrientation();
+    modification.orientationApres = pieces[index].getOrientation();
+    modification.avant = avant;
+    modification.apres = positions[index];
+    modification.coups = coups;
+    modification.poseeAvant = poseeAvant;
+    modification.poseeApres = piecesPosees[index];
+    modification.suiteGroupe = suiteGroupe;
+    empilerModification(modification);
+}
+
+void Model::empilerModification(const Modification& modification) {
+    historique.erase(historique.begin() + curseurHistorique, historique.end());
+    historique.push_back(modification);
+    curseurHistorique = historique.size();
+    if (historique.size() > limiteHistorique) {
+        compacterHistorique();
+    }
+}
+
+void Model::compacterHistorique() {
+    // 1. Dans la moitié la plus ancienne de ce qui est annulable, fusionner les coups
+    //    successifs d'une même pièce (hors réinitialisations) : ils s'annuleront d'un bloc
+    size_t zone = curseurHistorique / 2;
+    size_t lecture = 0;
+    size_t ecriture = 0;
+    bool precedenteFusionnable = false;
+    for (; lecture < historique.size(); ++lecture) {
+        const Modification& courante = historique[lecture];
+        bool fusionnable = lecture < zone && !courante.suiteGroupe
+            && (lecture + 1 == historique.size() || !historique[lecture + 1].suiteGroupe);
+        if (fusionnable && precedenteFusionnable && historique[ecriture - 1].piece == courante.piece) {
+            Modification& cible = historique[ecriture - 1];
+            cible.formeApres = courante.formeApres;
+            cible.decalageApres = courante.decalageApres;
+            cible.orientationApres = courante.orientationApres;
+            cible.apres = courante.apres;
+            cible.poseeApres = courante.poseeApres;
+            cible.coups += courante.coups;
+            --curseurHistorique;
+            continue;
+        }
+        historique[ecriture++] = courante;
+        precedenteFusionnable = fusionnable;
+    }
+    historique.resize(ecriture);
+
+    // 2. Oublier les plus anciennes entrées, par groupes entiers, jusqu'aux trois quarts de la
+    //    limite : la compaction suivante n'aura lieu qu'après limite / 4 nouveaux coups
+    size_t cible = max<size_t>(1, limiteHistorique * 3 / 4);
+    size_t retirees = 0;
+    while (historique.size() - retirees > cible && retirees < curseurHistorique) {
+        do {
+            ++retirees;
+        } while (retirees < historique.size() && retirees < curseurHistorique
+                 && historique[retirees].suiteGroupe);
+    }
+    historique.erase(historique.begin(), historique.begin() + retirees);
+    curseurHistorique -= retirees;
+    if (!historique.empty()) {
+        historique.front().suiteGroupe = false;
+    }
+}
+
+void Model::appliquerHistorique(size_t debut, size_t fin, bool retour) {
+    // Retirer d'abord toutes les pièces concernées : dans une réinitialisation,
+    // une pièce peut revenir sur des cases qu'une autre libère
+    for (size_t i = debut; i < fin; ++i) {
+        size_t index = historique[i].piece;
+        if (piecesPosees[index]) {
+            grid.retirerPiece(pieces[index], positions[index].first, positions[index].second);
+        }
+    }
+    for (size_t i = debut; i < fin; ++i) {
+        const Modification& modification = historique[i];
+        size_t index = modification.piece;
+        pieces[index].coordinates = retour
+            ? formeHistorique(modification.formeAvant, modification.decalageAvant)
+            : formeHistorique(modification.formeApres, modification.decalageApres);
+        pieces[index].orientation = retour ? modification.orientationAvant : modification.orientationApres;
+        positions[index] = retour ? modification.avant : modification.apres;
+        piecesPosees[index] = retour ? modification.poseeAvant : modification.poseeApres;
+        nbCoups += retour ? -modification.coups : modification.coups;
+        noterModification(index);
+    }
+    for (size_t i = debut; i < fin; ++i) {
+        size_t index = historique[i].piece;
+        if (piecesPosees[index]) {
+            grid.placePiece(pieces[index], positions[index].first, positions[index].second);
+        }
+    }
+
+    pieceActive = historique[debut].piece;
+    atteignabiliteValide = false;
+    notifyObservers();
+}
+
+bool Model::annuler() {
+    if (curseurHistorique == 0) {
+        return false;
+    }
+    size_t fin = curseurHistorique;
+    size_t debut = fin - 1;
+    while (debut > 0 && historique[debut].suiteGroupe) {
+        --debut;
+    }
+    appliquerHistorique(debut, fin, true);
+    curseurHistorique = debut;
+    if (journal) {
+        journal->noterAnnulation();
+    }
+    return true;
+}
+
+bool Model::retablir() {
+    if (curseurHistorique >= historique.size()) {
+        return false;
+    }
+    size_t debut = curseurHistorique;
+    size_t fin = debut + 1;
+    while (fin < historique.size() && historique[fin].suiteGroupe) {
+        ++fin;
+    }
+    appliquerHistorique(debut, fin, false);
+    curseurHistorique = fin;
+    if (journal) {
+        journal->noterRetablissement();
+    }
+    return true;
+}
+
+void Model::viderHistorique() {
+    historique.clear();
+    curseurHistorique = 0;
+    formesHistorique.clear();
+    indexFormes.clear();
+}
+
+void Model::setLimiteHistorique(size_t limite) {
+    limiteHistorique = max<size_t>(2, limite);
+    if (historique.size() > limiteHistorique) {
+        compacterHistorique();
+    }
+}
+
+// Instantanés
+Model::Instantane Model::figerEtat() const {
+    if (!dernierEtat || dernierEtatPerime) {
+        // Copie des pointeurs de l'état précédent : seules les pièces modifiées sont recalculées,
+        // et une forme inchangée reste partagée
+        bool complet = !dernierEtat;
+        shared_ptr<vector<EtatPiece>> etat(complet ? new vector<EtatPiece>(pieces.size())
+                                                   : new vector<EtatPiece>(*dernierEtat));
+        for (size_t i = 0; i < pieces.size(); ++i) {
+            if (!complet && !piecesModifiees[i]) {
+                continue;
+            }
+            EtatPiece& piece = (*etat)[i];
+            const Coordonnees& coords = pieces[i].getCoordinates();
+            if (!piece.forme || *piece.forme != coords) {
+                piece.forme = shared_ptr<const Coordonnees>(new Coordonnees(coords));
+            }
+            piece.position = positions[i];
+            piece.posee = piecesPosees[i];
+            piece.orientation = pieces[i].getOrientation();
+            piecesModifiees[i] = false;
+        }
+        dernierEtat = etat;
+        dernierEtatPerime = false;
+    }
+
+    Instantane instantane;
+    instantane.pieces = dernierEtat;
+    instantane.origine = this;
+    instantane.generation = generationPieces;
+    instantane.pieceActive = pieceActive;
+    instantane.nbCoups = nbCoups;
+    return instantane;
+}
+
+Model::Instantane Model::prendreInstantane() const {
+    Instantane instantane = figerEtat();
+    instantane.numero = ++prochainInstantane;
+    if (journal) {
+        journal->noterInstantane(instantane.numero);
+    }
+    return instantane;
+}
+
+void Model::restaurer(const Instantane& instantane) {
+    appliquerInstantane(instantane, instantane.nbCoups);
+    pieceActive = instantane.pieceActive;
+    if (journal) {
+        journal->noterRestauration(instantane.numero);
+    }
+    notifyObservers();
+}
+
+void Model::storeInitialPositions() {
+    nbCoups = 0;
+    viderHistorique();
+    etatInitial = figerEtat();
+}
+
+void Model::resetToInitialPositions() {
+    // Jamais fixée, ou prise avant l'ajout de pièces : la position courante devient la position initiale
+    if (etatInitial.estVide() || etatInitial.generation != generationPieces) {
+        etatInitial = figerEtat();
+    }
+    appliquerInstantane(etatInitial, 0);
+    pieceActive = pieceADeplacer;
+    if (journal) {
+        journal->noterReinitialisation();
+    }
+    notifyObservers();
+}
+
+void Model::noterModification(size_t index) const {
+    if (index < piecesModifiees.size() && !piecesModifiees[index]) {
+        piecesModifiees[index] = true;
+        dernierEtatPerime = true;
+    }
+}
+
+void Model::remplacerPieces() {
+    ++generationPieces;
+    dernierEtat.reset();
+    piecesModifiees.assign(pieces.size(), false);
+    dernierEtatPerime = true;
+}
+
+void Model::appliquerInstantane(const Instantane& cible, unsigned long coupsApres) {
+    if (cible.estVide() || cible.origine != this || cible.generation != generationPieces
+        || cible.pieces->size() != pieces.size()) {
+        throw invalid_argument("Instantané pris sur d'autres pièces que celles du Model");
+    }
+
+    // Pièces qui diffèrent ; une forme encore partagée avec dernierEtat n'est pas comparée
+    vector<size_t> differentes;
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        const EtatPiece& etat = (*cible.pieces)[i];
+        bool memeForme = (dernierEtat && !piecesModifiees[i] && (*dernierEtat)[i].forme == etat.forme)
+                      || pieces[i].getCoordinates() == *etat.forme;
+        if (!memeForme || piecesPosees[i] != etat.posee || positions[i] != etat.position) {
+            differentes.push_back(i);
+        }
+    }
+    long coups = static_cast<long>(coupsApres) - static_cast<long>(nbCoups);
+    if (differentes.empty()) {
+        if (coups == 0 || pieces.empty()) {
+            return;
+        }
+        differentes.push_back(pieceActive);  // Porte seulement la variation du nombre de coups
+    }
+
+    // Une entrée d'historique par pièce, annulées ensemble
+    for (size_t k = 0; k < differentes.size(); ++k) {
+        size_t i = differentes[k];
+        const EtatPiece& etat = (*cible.pieces)[i];
+        Modification modification;
+        modification.piece = static_cast<uint32_t>(i);
+        modification.formeAvant = indexerForme(pieces[i].getCoordinates(), modification.decalageAvant);
+        modification.formeApres = indexerForme(*etat.forme, modification.decalageApres);
+        modification.orientationAvant = pieces[i].getOrientation();
+        modification.orientationApres = etat.orientation;
+        modification.avant = positions[i];
+        modification.apres = etat.position;
+        modification.coups = (k == 0) ? coups : 0;
+        modification.poseeAvant = piecesPosees[i];
+        modification.poseeApres = etat.posee;
+        modification.suiteGroupe = k > 0;
+        empilerModification(modification);
+    }
+
+    // Retirer toutes les pièces concernées avant d'en reposer une : elles peuvent échanger leurs cases
+    for (size_t i : differentes) {
+        if (piecesPosees[i]) {
+            grid.retirerPiece(pieces[i], positions[i].first, positions[i].second);
+        }
+    }
+    for (size_t i : differentes) {
+        const EtatPiece& etat = (*cible.pieces)[i];
+        pieces[i].coordinates = *etat.forme;
+        pieces[i].orientation = etat.orientation;
+        positions[i] = etat.position;
+        piecesPosees[i] = etat.posee;
+        noterModification(i);
+        if (piecesPosees[i]) {
+            grid.placePiece(pieces[i], positions[i].first, positions[i].second);
+        }
+    }
+    nbCoups = coupsApres;
+    atteignabiliteValide = false;
+}
+
+// Espace des configurations
+void Model::precalculerEspaceConfiguration() const {
+    espaceConfiguration.assign(pieces.size(), ConfigurationPiece());
+
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        ConfigurationPiece& configuration = espaceConfiguration[i];
+        configuration.orientationBase = pieces[i].getOrientation();
+        const Coordonnees& coords = pieces[i].getCoordinates();
+        if (coords.empty()) {
+            continue;
+        }
+
+        // Les 8 images de la pièce par rotations et symétries, à translation près,
+        // numérotées comme les orientations de PieceConcrete
+        for (uint8_t t = 0; t < PieceConcrete::NB_ORIENTATIONS; ++t) {
+            OrientationPiece orientation;
+            for (const pair<int, int>& coord : coords) {
+                int x = coord.first;
+                int y = coord.second;
+                for (int r = 0; r < t % 4; ++r) {
+                    int tmp = x;
+                    x = -y;
+                    y = tmp;
+                }
+                if (t >= 4) {
+                    x = -x;
+                }
+                orientation.forme.push_back(make_pair(x, y));
+            }
+
+            int minX = INT_MAX, minY = INT_MAX, maxX = INT_MIN, maxY = INT_MIN;
+            for (const pair<int, int>& cell : orientation.forme) {
+                minX = std::min(minX, cell.first);
+                minY = std::min(minY, cell.second);
+                maxX = std::max(maxX, cell.first);
+                maxY = std::max(maxY, cell.second);
+            }
+            for (pair<int, int>& cell : orientation.forme) {
+                cell.first -= minX;
+                cell.second -= minY;
+            }
+            configuration.premiereCase[t] = orientation.forme[0];  // Les opérateurs gardent l'ordre des cases
+            sort(orientation.forme.begin(), orientation.forme.end());
+
+            // Réutiliser une orientation déjà rencontrée (pièces symétriques)
+            size_t index = 0;
+            while (index < configuration.orientations.size()
+                   && configuration.orientations[index].forme != orientation.forme) {
+                ++index;
+            }
+            configuration.indexOrientation[t] = static_cast<uint8_t>(index);
+            if (index < configuration.orientations.size()) {
+                continue;
+            }
+
+            orientation.largeur = maxX - minX + 1;
+            orientation.hauteur = maxY - minY + 1;
+            orientation.ancrages.assign(width * height, false);
+            for (int ay = 0; ay + orientation.hauteur <= height; ++ay) {
+                for (int ax = 0; ax + orientation.largeur <= width; ++ax) {
+                    bool valide = true;
+                    for (const pair<int, int>& cell : orientation.forme) {
+                        if (!estZoneAutorisee(ax + cell.first, ay + cell.second)) {
+                            valide = false;
+                            break;
+                        }
+                    }
+                    orientation.ancrages[ay * width + ax] = valide;
+                }
+            }
+            configuration.orientations.push_back(orientation);
+        }
+    }
+
+    espaceConfigurationValide = true;
+}
+
+const Model::OrientationPiece* Model::trouverOrientation(size_t index, const PieceConcrete& piece,
+                                                        int& minX, int& minY) const {
+    if (!espaceConfigurationValide) {
+        precalculerEspaceConfiguration();
+    }
+
+    const ConfigurationPiece& configuration = espaceConfiguration[index];
+    const Coordonnees& coords = piece.getCoordinates();
+    if (coords.empty() || configuration.orientations.empty()) {
+        return nullptr;
+    }
+
+    // Transformation depuis la forme du précalcul, puis coin de la boîte par la première case
+    uint8_t t = PieceConcrete::composerOrientations(piece.getOrientation(),
+                                                    PieceConcrete::inverserOrientation(configuration.orientationBase));
+    minX = coords[0].first - configuration.premiereCase[t].first;
+    minY = coords[0].second - configuration.premiereCase[t].second;
+    return &configuration.orientations[configuration.indexOrientation[t]];
+}
+
+bool Model::estPlacementStatiqueValide(size_t index, const PieceConcrete& piece,
+                                       const pair<int, int>& position) const {
+    const Coordonnees& coords = piece.getCoordinates();
+    if (index >= pieces.size() || coords.empty()) {
+        return false;
+    }
+
+    // Un seul bit de l'espace des configurations
+    int minX, minY;
+    const OrientationPiece* orientation = trouverOrientation(index, piece, minX, minY);
+    if (orientation) {
+        int ax = position.first + minX;
+        int ay = position.second + minY;
+        if (ax < 0 || ax >= width || ay < 0 || ay >= height) {
+            return false;
+        }
+        return orientation->ancrages[ay * width + ax];
+    }
+
+    // Pièce sans orientation précalculée : vérification case par case
+    for (const pair<int, int>& coord : coords) {
+        int x = position.first + coord.first;
+        int y = position.second + coord.second;
+        if (x < 0 || x >= width || y < 0 || y >= height || !estZoneAutorisee(x, y)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Atteignabilité de la pièce à déplacer
+void Model::calculerAtteignabilite() const {
+    predecesseurs.assign(width * height, -2);
+    atteignabiliteValide = true;
+
+    if (pieceADeplacer >= pieces.size() || !piecesPosees[pieceADeplacer]) {
+        return;
+    }
+
+    int minX, minY;
+    const OrientationPiece* orientation = trouverOrientation(pieceADeplacer, pieces[pieceADeplacer], minX, minY);
+    decalageAtteignabilite = make_pair(minX, minY);
+
+    int departX = positions[pieceADeplacer].first + minX;
+    int departY = positions[pieceADeplacer].second + minY;
+    if (!orientation || departX < 0 || departX >= width || departY < 0 || departY >= height) {
+        return;
+    }
+
+    // Cases occupées par les autres pièces (la pièce à déplacer libère les siennes en bougeant)
+    vector<int> occupation = construireOccupation();
+
+    // Parcours en largeur sur les ancrages : le premier chemin trouvé est le plus court
+    vector<int> file;
+    file.reserve(width * height);
+    int depart = departY * width + departX;
+    predecesseurs[depart] = -1;
+    file.push_back(depart);
+
+    const int dx[] = { 0, 0, 1, -1 };
+    const int dy[] = { -1, 1, 0, 0 };
+    for (size_t tete = 0; tete < file.size(); ++tete) {
+        int ax = file[tete] % width;
+        int ay = file[tete] / width;
+        for (int d = 0; d < 4; ++d) {
+            int nx = ax + dx[d];
+            int ny = ay + dy[d];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+                continue;
+            }
+            int voisin = ny * width + nx;
+            if (predecesseurs[voisin] != -2 || !orientation->ancrages[voisin]) {
+                continue;
+            }
+
+            bool libre = true;
+            for (const pair<int, int>& cell : orientation->forme) {
+                int occupant = occupation[(ny + cell.second) * width + nx + cell.first];
+                if (occupant != -1 && occupant != static_cast<int>(pieceADeplacer)) {
+                    libre = false;
+                    break;
+                }
+            }
+            if (libre) {
+                predecesseurs[voisin] = file[tete];
+                file.push_back(voisin);
+            }
+        }
+    }
+}
+
+bool Model::estPositionAtteignable(const pair<int, int>& position) const {
+    if (!atteignabiliteValide) {
+        calculerAtteignabilite();
+    }
+    int ax = position.first + decalageAtteignabilite.first;
+    int ay = position.second + decalageAtteignabilite.second;
+    if (ax < 0 || ax >= width || ay < 0 || ay >= height) {
+        return false;
+    }
+    return predecesseurs[ay * width + ax] != -2;
+}
+
+vector<pair<int, int>> Model::getChemin(const pair<int, int>& destination) const {
+    vector<pair<int, int>> chemin;
+    if (!estPositionAtteignable(destination)) {
+        return chemin;
+    }
+
+    // Remonter les prédécesseurs depuis la destination jusqu'au départ
+    int courant = (destination.second + decalageAtteignabilite.second) * width
+                + destination.first + decalageAtteignabilite.first;
+    while (courant != -1) {
+        chemin.push_back(make_pair(courant % width - decalageAtteignabilite.first,
+                                   courant / width - decalageAtteignabilite.second));
+        courant = predecesseurs[courant];
+    }
+    reverse(chemin.begin(), chemin.end());
+    return chemin;
+}
+
+// Aperçus
+bool Model::estEmpreinteLibre(size_t index, const Coordonnees& coords,
+                              const pair<int, int>& position) const {
+    // La grille est à jour : une case est libre si elle est vide ou déjà occupée par la pièce
+    for (const pair<int, int>& coord : coords) {
+        int x = position.first + coord.first;
+        int y = position.second + coord.second;
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            return false;
+        }
+        const Piece* occupant = grid.getOccupant(x, y);
+        if (occupant && occupant != &pieces[index]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Apercu Model::apercuPlacement(size_t index, int x, int y) const {
+    Apercu apercu = { false, make_pair(x, y), Coordonnees(), false };
+    if (index >= pieces.size()) {
+        return apercu;
+    }
+    apercu.coordonnees = pieces[index].getCoordinates();
+    apercu.valide = estEmpreinteLibre(index, apercu.coordonnees, apercu.position);
+    apercu.dansLesZones = estPlacementStatiqueValide(index, pieces[index], apercu.position);
+    return apercu;
+}
+
+Apercu Model::apercuInchange(size_t index) const {
+    Apercu apercu = { false, positions[index], pieces[index].getCoordinates(), false };
+    apercu.dansLesZones = estPlacementStatiqueValide(index, pieces[index], apercu.position);
+    return apercu;
+}
+
+Apercu Model::apercuTransformation(size_t index, PieceConcrete& copie, PieceOperateur& operateur) const {
+    try {
+        copie.accept(operateur);
+    }
+    catch (const exception&) {
+        return apercuInchange(index);  // Transformation impossible (pièce d'une seule case) : rien ne change
+    }
+    Apercu apercu = { false, positions[index], Coordonnees(), false };
+    apercu.coordonnees = copie.getCoordinates();
+    apercu.dansLesZones = estPlacementStatiqueValide(index, copie, apercu.position);
+    apercu.valide = piecesPosees[index] && apercu.dansLesZones
+        && estEmpreinteLibre(index, apercu.coordonnees, apercu.position);
+    return apercu;
+}
+
+Apercu Model::apercuDeplacement(size_t index, OrientationDeplacement direction) const {
+    if (index >= pieces.size()) {
+        return Apercu{ false, make_pair(-1, -1), Coordonnees(), false };
+    }
+    PieceConcrete copie = pieces[index];
+    OperateurDeplacement deplacement(copie, positions[index], direction);
+    return apercuTransformation(index, copie, deplacement);
+}
+
+Apercu Model::apercuRotation(size_t index, OrientationRotation sens) const {
+    if (index >= pieces.size()) {
+        return Apercu{ false, make_pair(-1, -1), Coordonnees(), false };
+    }
+    if (pieces[index].getCoordinates().size() < 2) {
+        // Pas de centre (pièce d'une seule case) : inutile de lever l'exception de l'opérateur
+        return apercuInchange(index);
+    }
+    PieceConcrete copie = pieces[index];
+    OperateurRotation rotation(copie, positions[index], sens);
+    return apercuTransformation(index, copie, rotation);
+}
+
+Apercu Model::apercuSymetrie(size_t index, OrientationSymetrie sens) const {
+    if (index >= pieces.size()) {
+        return Apercu{ false, make_pair(-1, -1), Coordonnees(), false };
+    }
+    if (pieces[index].getCoordinates().size() < 2) {
+        // Pas de centre (pièce d'une seule case) : inutile de lever l'exception de l'opérateur
+        return apercuInchange(index);
+    }
+    PieceConcrete copie = pieces[index];
+    OperateurSymetrie symetrie(copie, positions[index], sens);
+    return apercuTransformation(index, copie, symetrie);
+}
+
+// Générateur de coups légaux
+vector<Coup> Model::genererCoups() const {
+    vector<Coup> coups;
+    vector<int> occupation = construireOccupation();  // Calculée une seule fois pour toutes les pièces
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        genererCoupsPiece(i, occupation, coups);
+    }
+    return coups;
+}
+
+vector<Coup> Model::genererCoups(size_t index) const {
+    vector<Coup> coups;
+    if (index < pieces.size()) {
+        genererCoupsPiece(index, construireOccupation(), coups);
+    }
+    return coups;
+}
+
+vector<int> Model::construireOccupation() const {
+    vector<int> occupation(width * height, -1);
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        if (!piecesPosees[i]) {
+            continue;
+        }
+        for (const pair<int, int>& coord : pieces[i].getCoordinates()) {
+            int x = positions[i].first + coord.first;
+            int y = positions[i].second + coord.second;
+            if (x >= 0 && x < width && y >= 0 && y < height) {
+                occupation[y * width + x] = static_cast<int>(i);
+            }
+        }
+    }
+    return occupation;
+}
+
+bool Model::estEmpreinteLegale(const PieceConcrete& piece, const pair<int, int>& position,
+                               size_t pieceIndex, const vector<int>& occupation) const {
+    // Mêmes règles que appliquerTransformation : dans la grille et autorisée, puis libre (ou déjà à nous)
+    if (!estPlacementStatiqueValide(pieceIndex, piece, position)) {
+        return false;
+    }
+    for (const pair<int, int>& coord : piece.getCoordinates()) {
+        int occupant = occupation[(position.second + coord.second) * width + position.first + coord.first];
+        if (occupant != -1 && occupant != static_cast<int>(pieceIndex)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Model::genererCoupsPiece(size_t index, const vector<int>& occupation, vector<Coup>& coups) const {
+    if (!piecesPosees[index]) {
+        return;
+    }
+
+    const pair<int, int>& position = positions[index];
+    Coup coup;
+    coup.piece = index;
+    coup.direction = OrientationDeplacement::NORD;
+    coup.rotation = OrientationRotation::HORAIRE;
+    coup.symetrie = OrientationSymetrie::HORIZONTALE;
+    coup.position = position;
+
+    // Les opérateurs sont appliqués sur une copie : la pièce du modèle reste intacte
+    const OrientationDeplacement directions[] = {
+        OrientationDeplacement::NORD, OrientationDeplacement::SUD,
+        OrientationDeplacement::EST, OrientationDeplacement::OUEST
+    };
+    for (OrientationDeplacement direction : directions) {
+        PieceConcrete copie = pieces[index];
+        OperateurDeplacement deplacement(copie, position, direction);
+        copie.accept(deplacement);
+        if (estEmpreinteLegale(copie, position, index, occupation)) {
+            coup.type = TypeCoup::DEPLACEMENT;
+            coup.direction = direction;
+            coup.coordonnees = copie.getCoordinates();
+            coups.push_back(coup);
+        }
+    }
+
+    const OrientationRotation sensRotation[] = { OrientationRotation::HORAIRE, OrientationRotation::ANTIHORAIRE };
+    for (OrientationRotation sens : sensRotation) {
+        PieceConcrete copie = pieces[index];
+        OperateurRotation rotation(copie, position, sens);
+        try {
+            copie.accept(rotation);
+        }
+        catch (const exception&) {
+            continue;  // Pas de centre de rotation (pièce d'une seule case)
+        }
+        if (estEmpreinteLegale(copie, position, index, occupation)) {
+            coup.type = TypeCoup::ROTATION;
+            coup.rotation = sens;
+            coup.coordonnees = copie.getCoordinates();
+            coups.push_back(coup);
+        }
+    }
+
+    const OrientationSymetrie sensSymetrie[] = { OrientationSymetrie::HORIZONTALE, OrientationSymetrie::VERTICALE };
+    for (OrientationSymetrie sens : sensSymetrie) {
+        PieceConcrete copie = pieces[index];
+        OperateurSymetrie symetrie(copie, position, sens);
+        try {
+            copie.accept(symetrie);
+        }
+        catch (const exception&) {
+            continue;  // Pas de centre de symétrie (pièce d'une seule case)
+        }
+        if (estEmpreinteLegale(copie, position, index, occupation)) {
+            coup.type = TypeCoup::SYMETRIE;
+            coup.symetrie = sens;
+            coup.coordonnees = copie.getCoordinates();
+            coups.push_back(coup);
+        }
+    }
 }
 
 // Nouvelle méthode utilitaire pour vérifier la validité d'une transformation
@@ -271,7 +1263,10 @@ void Model::effacerGrille() {
     for (size_t i = 0; i < pieces.size(); ++i) {
         positions[i] = make_pair(-1, -1);
         piecesPosees[i] = false;
+        noterModification(i);
     }
+    atteignabiliteValide = false;
+    viderHistorique();  // L'historique ne décrit plus les pièces
     notifyObservers();
 }
 
@@ -305,6 +1300,7 @@ void Model::setZoneArrivee(int x, int y) {
 void Model::setPieceADeplacer(size_t index) {
     if (index < pieces.size()) {
         pieceADeplacer = index;
+        atteignabiliteValide = false;
         notifyObservers();
     }
 }
@@ -316,6 +1312,14 @@ pair<int, int> Model::getZoneArrivee() const {
     return *zonesArrivee.begin();  // Retourne la première zone pour compatibilité
 }
 
+void Model::setOrientationBut(OrientationBut orientation) {
+    orientationBut = orientation;
+}
+
+OrientationBut Model::getOrientationBut() const {
+    return orientationBut;
+}
+
 size_t Model::getPieceADeplacer() const {
     return pieceADeplacer;
 }
@@ -324,6 +1328,12 @@ bool Model::isPartieGagnee() const {
     return verifierVictoire();
 }
 
+void Model::annoncerVictoire() const {
+    if (messages && pieceActive == pieceADeplacer && verifierVictoire()) {
+        *messages << "🎉 Félicitations ! Vous avez gagné !" << endl;
+    }
+}
+
 bool Model::verifierVictoire() const {
     // Si la pièce n'est pas posée, pas de victoire possible
     if (!piecesPosees[pieceADeplacer]) {
@@ -331,11 +1341,18 @@ bool Model::verifierVictoire() const {
     }
 
     // Vérifier que toutes les parties de la pièce sont sur des zones d'arrivée
-    const vector<pair<int, int>>& coords = pieces[pieceADeplacer].getCoordinates();
+    const Coordonnees& coords = pieces[pieceADeplacer].getCoordinates();
     const pair<int, int>& pos = positions[pieceADeplacer];
 
-    // Pour le niveau 2 (pièce en forme de P avec 4 cases), toutes les cases doivent être sur des zones d'arrivée
-    if (coords.size() == 4) {  // Si c'est la pièce en forme de P (niveau 2)
+    // Orientation imposée par le niveau ; à défaut, la pièce en forme de P du niveau 2 (4 cases)
+    // doit arriver à l'horizontale
+    OrientationBut but = orientationBut;
+    if (but == OrientationBut::LIBRE && coords.size() == 4) {
+        but = OrientationBut::HORIZONTALE;
+    }
+
+    // Avec une orientation imposée, toutes les cases doivent être sur des zones d'arrivée
+    if (but != OrientationBut::LIBRE) {
         // Vérifier que toutes les cases sont sur des zones d'arrivée
         for (const pair<int, int>& coord : coords) {
             int x = pos.first + coord.first;
@@ -346,7 +1363,7 @@ bool Model::verifierVictoire() const {
             }
         }
 
-        // Vérifier que la pièce a la bonne orientation (horizontale)
+        // Vérifier que la pièce a la bonne orientation
         int minX = INT_MAX, maxX = INT_MIN;
         int minY = INT_MAX, maxY = INT_MIN;
 
@@ -361,11 +1378,11 @@ bool Model::verifierVictoire() const {
         int largeur = maxX - minX + 1;
         int hauteur = maxY - minY + 1;
 
-        // La pièce doit être horizontale (largeur > hauteur)
-        return largeur > hauteur;
+        // Horizontale : largeur > hauteur, verticale : hauteur > largeur
+        return (but == OrientationBut::HORIZONTALE) ? largeur > hauteur : hauteur > largeur;
     }
 
-    // Pour les autres niveaux (1 et 3), une seule case sur une zone d'arrivée suffit
+    // Sans orientation imposée (niveaux 1 et 3), une seule case sur une zone d'arrivée suffit
     for (const pair<int, int>& coord : coords) {
         int x = pos.first + coord.first;
         int y = pos.second + coord.second;
@@ -380,11 +1397,17 @@ bool Model::verifierVictoire() const {
 
 void Model::ajouterZoneAutorisee(int x, int y) {
     zonesAutorisees.insert(make_pair(x, y));
+    espaceConfigurationValide = false;
+    atteignabiliteValide = false;
+    ++revisionZones;
     notifyObservers();
 }
 
 void Model::viderZonesAutorisees() {
     zonesAutorisees.clear();
+    espaceConfigurationValide = false;
+    atteignabiliteValide = false;
+    ++revisionZones;
     notifyObservers();
 }
 
@@ -394,11 +1417,13 @@ bool Model::estZoneAutorisee(int x, int y) const {
 
 void Model::ajouterZoneArrivee(int x, int y) {
     zonesArrivee.insert(make_pair(x, y));
+    ++revisionZones;
     notifyObservers();
 }
 
 void Model::viderZonesArrivee() {
     zonesArrivee.clear();
+    ++revisionZones;
     notifyObservers();
 }
 
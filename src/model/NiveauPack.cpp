@@ -0,0 +1,281 @@
+#include "model/NiveauPack.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    const char MAGIC[4] = { 'P', 'C', 'P', 'K' };
+    const uint16_t VERSION = 2;
+    const size_t TAILLE_EN_TETE = 12;
+
+    // Écriture little-endian, indépendante de la plateforme
+    void ecrireU8(vector<uint8_t>& sortie, uint8_t valeur) {
+        sortie.push_back(valeur);
+    }
+
+    void ecrireU16(vector<uint8_t>& sortie, uint16_t valeur) {
+        sortie.push_back(static_cast<uint8_t>(valeur & 0xFF));
+        sortie.push_back(static_cast<uint8_t>(valeur >> 8));
+    }
+
+    void ecrireU32(vector<uint8_t>& sortie, uint32_t valeur) {
+        for (int i = 0; i < 4; ++i) {
+            sortie.push_back(static_cast<uint8_t>((valeur >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void ecrireBitmap(vector<uint8_t>& sortie, const vector<bool>& bitmap) {
+        for (size_t i = 0; i < bitmap.size(); i += 8) {
+            uint8_t octet = 0;
+            for (size_t b = 0; b < 8 && i + b < bitmap.size(); ++b) {
+                if (bitmap[i + b]) {
+                    octet |= static_cast<uint8_t>(1 << b);
+                }
+            }
+            sortie.push_back(octet);
+        }
+    }
+
+    uint16_t lireU16(const uint8_t* p) {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    uint32_t lireU32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+             | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+}
+
+// EcrivainPack implementation
+EcrivainPack::EcrivainPack() : taillePack(TAILLE_EN_TETE + 4) {}
+
+void EcrivainPack::ajouterNiveau(const Niveau& niveau) {
+    if (niveau.largeur <= 0 || niveau.largeur > 0xFFFF || niveau.hauteur <= 0 || niveau.hauteur > 0xFFFF) {
+        throw invalid_argument("Dimensions de niveau non représentables dans un pack");
+    }
+    size_t nbCellules = static_cast<size_t>(niveau.largeur) * niveau.hauteur;
+    if (niveau.zonesAutorisees.size() != nbCellules || niveau.zonesArrivee.size() != nbCellules) {
+        throw invalid_argument("Zones du niveau incohérentes avec ses dimensions");
+    }
+    if (niveau.pieces.size() > 0xFFFF) {
+        throw invalid_argument("Trop de pièces pour un pack");
+    }
+    if (niveau.positions.size() != niveau.pieces.size() || niveau.posees.size() != niveau.pieces.size() ||
+        niveau.pieceADeplacer >= niveau.pieces.size()) {
+        throw invalid_argument("Positions ou pièce à déplacer incohérentes avec les pièces");
+    }
+
+    // Taille sérialisée : en-tête du niveau, pièces, deux bitmaps, et son entrée d'index
+    uint64_t tailleNiveau = 9 + 2 * ((nbCellules + 7) / 8) + 4;
+    for (size_t i = 0; i < niveau.pieces.size(); ++i) {
+        if (niveau.pieces[i].size() > 0xFF) {
+            throw invalid_argument("Pièce trop grande pour un pack");
+        }
+        for (const pair<int, int>& coord : niveau.pieces[i]) {
+            if (coord.first < -128 || coord.first > 127 || coord.second < -128 || coord.second > 127) {
+                throw invalid_argument("Coordonnées de pièce non représentables dans un pack");
+            }
+        }
+        const pair<int, int>& position = niveau.positions[i];
+        if (position.first < -32768 || position.first > 32767 || position.second < -32768 || position.second > 32767) {
+            throw invalid_argument("Position de pièce non représentable dans un pack");
+        }
+        tailleNiveau += 6 + 2 * niveau.pieces[i].size();
+    }
+    if (taillePack + tailleNiveau > 0xFFFFFFFFu) {
+        throw invalid_argument("Pack trop volumineux : les offsets sont sur 32 bits");
+    }
+
+    niveaux.push_back(niveau);
+    taillePack += tailleNiveau;
+}
+
+void EcrivainPack::ecrire(const string& chemin) const {
+    vector<uint8_t> sortie;
+
+    // En-tête
+    sortie.insert(sortie.end(), MAGIC, MAGIC + 4);
+    ecrireU16(sortie, VERSION);
+    ecrireU16(sortie, 0);
+    ecrireU32(sortie, static_cast<uint32_t>(niveaux.size()));
+
+    // Index, rempli une fois les niveaux sérialisés
+    size_t debutIndex = sortie.size();
+    sortie.resize(sortie.size() + (niveaux.size() + 1) * 4);
+
+    for (size_t n = 0; n < niveaux.size(); ++n) {
+        const Niveau& niveau = niveaux[n];
+        uint32_t offset = static_cast<uint32_t>(sortie.size());
+        for (int i = 0; i < 4; ++i) {
+            sortie[debutIndex + n * 4 + i] = static_cast<uint8_t>((offset >> (8 * i)) & 0xFF);
+        }
+
+        ecrireU16(sortie, static_cast<uint16_t>(niveau.largeur));
+        ecrireU16(sortie, static_cast<uint16_t>(niveau.hauteur));
+        ecrireU16(sortie, static_cast<uint16_t>(niveau.pieces.size()));
+        ecrireU16(sortie, static_cast<uint16_t>(niveau.pieceADeplacer));
+        ecrireU8(sortie, static_cast<uint8_t>(niveau.orientationBut));
+
+        for (size_t i = 0; i < niveau.pieces.size(); ++i) {
+            ecrireU8(sortie, static_cast<uint8_t>(niveau.pieces[i].size()));
+            ecrireU8(sortie, niveau.posees[i] ? 1 : 0);
+            ecrireU16(sortie, static_cast<uint16_t>(static_cast<int16_t>(niveau.positions[i].first)));
+            ecrireU16(sortie, static_cast<uint16_t>(static_cast<int16_t>(niveau.positions[i].second)));
+            for (const pair<int, int>& coord : niveau.pieces[i]) {
+                ecrireU8(sortie, static_cast<uint8_t>(static_cast<int8_t>(coord.first)));
+                ecrireU8(sortie, static_cast<uint8_t>(static_cast<int8_t>(coord.second)));
+            }
+        }
+
+        ecrireBitmap(sortie, niveau.zonesAutorisees);
+        ecrireBitmap(sortie, niveau.zonesArrivee);
+    }
+
+    uint32_t fin = static_cast<uint32_t>(sortie.size());
+    for (int i = 0; i < 4; ++i) {
+        sortie[debutIndex + niveaux.size() * 4 + i] = static_cast<uint8_t>((fin >> (8 * i)) & 0xFF);
+    }
+
+    // Écrire à côté puis renommer pour ne jamais laisser de pack tronqué
+    string temporaire = chemin + ".tmp";
+    {
+        ofstream fichier(temporaire.c_str(), ios::binary | ios::trunc);
+        if (!fichier) {
+            throw runtime_error("Impossible de créer le pack : " + temporaire);
+        }
+        fichier.write(reinterpret_cast<const char*>(sortie.data()), sortie.size());
+        if (!fichier) {
+            throw runtime_error("Erreur d'écriture du pack : " + temporaire);
+        }
+    }
+    if (rename(temporaire.c_str(), chemin.c_str()) != 0) {
+        remove(temporaire.c_str());
+        throw runtime_error("Impossible de renommer le pack : " + chemin);
+    }
+}
+
+// LecteurPack implementation
+LecteurPack::LecteurPack(const string& chemin) : descripteur(-1), donnees(nullptr), taille(0), nbNiveaux(0) {
+    descripteur = open(chemin.c_str(), O_RDONLY);
+    if (descripteur < 0) {
+        throw runtime_error("Impossible d'ouvrir le pack : " + chemin);
+    }
+
+    struct stat infos;
+    if (fstat(descripteur, &infos) != 0 || static_cast<size_t>(infos.st_size) < TAILLE_EN_TETE) {
+        close(descripteur);
+        throw runtime_error("Pack invalide : " + chemin);
+    }
+    taille = static_cast<size_t>(infos.st_size);
+
+    void* projection = mmap(nullptr, taille, PROT_READ, MAP_PRIVATE, descripteur, 0);
+    if (projection == MAP_FAILED) {
+        close(descripteur);
+        throw runtime_error("Impossible de projeter le pack : " + chemin);
+    }
+    donnees = static_cast<const uint8_t*>(projection);
+
+    // Seuls l'en-tête et l'index sont vérifiés ici, les niveaux le sont à la lecture
+    nbNiveaux = lireU32(donnees + 8);
+    bool valide = equal(MAGIC, MAGIC + 4, donnees)
+               && lireU16(donnees + 4) == VERSION
+               && TAILLE_EN_TETE + (static_cast<size_t>(nbNiveaux) + 1) * 4 <= taille;
+    if (!valide) {
+        munmap(const_cast<uint8_t*>(donnees), taille);
+        close(descripteur);
+        throw runtime_error("Pack invalide : " + chemin);
+    }
+}
+
+LecteurPack::~LecteurPack() {
+    munmap(const_cast<uint8_t*>(donnees), taille);
+    close(descripteur);
+}
+
+void LecteurPack::bornesNiveau(size_t n, size_t& debut, size_t& fin) const {
+    if (n >= nbNiveaux) {
+        throw out_of_range("Numéro de niveau hors du pack");
+    }
+    const uint8_t* index = donnees + TAILLE_EN_TETE;
+    debut = lireU32(index + n * 4);
+    fin = lireU32(index + (n + 1) * 4);
+    if (debut > fin || fin > taille) {
+        throw runtime_error("Index du pack corrompu");
+    }
+}
+
+Niveau LecteurPack::lireNiveau(size_t n) const {
+    size_t debut, fin;
+    bornesNiveau(n, debut, fin);
+    const uint8_t* p = donnees + debut;
+    const uint8_t* limite = donnees + fin;
+
+    if (limite - p < 9) {
+        throw runtime_error("Niveau du pack tronqué");
+    }
+    if (p[8] > static_cast<uint8_t>(OrientationBut::VERTICALE)) {
+        throw runtime_error("Orientation d'arrivée invalide dans le pack");
+    }
+    // Les deux bitmaps doivent tenir dans le niveau avant d'allouer la grille
+    int largeur = lireU16(p);
+    int hauteur = lireU16(p + 2);
+    size_t nbPieces = lireU16(p + 4);
+    size_t pieceADeplacer = lireU16(p + 6);
+    size_t tailleBitmap = (static_cast<size_t>(largeur) * hauteur + 7) / 8;
+    if (largeur == 0 || hauteur == 0 || static_cast<size_t>(limite - p) - 9 < 2 * tailleBitmap) {
+        throw runtime_error("Dimensions de niveau invalides dans le pack");
+    }
+    if (pieceADeplacer >= nbPieces) {
+        throw runtime_error("Pièce à déplacer invalide dans le pack");
+    }
+    Niveau niveau(largeur, hauteur);
+    niveau.pieceADeplacer = pieceADeplacer;
+    niveau.orientationBut = static_cast<OrientationBut>(p[8]);
+    p += 9;
+
+    niveau.pieces.resize(nbPieces);
+    niveau.positions.resize(nbPieces);
+    niveau.posees.resize(nbPieces);
+    for (size_t i = 0; i < nbPieces; ++i) {
+        if (limite - p < 6) {
+            throw runtime_error("Niveau du pack tronqué");
+        }
+        size_t nbCases = p[0];
+        bool posee = p[1] != 0;
+        int x = static_cast<int16_t>(lireU16(p + 2));
+        int y = static_cast<int16_t>(lireU16(p + 4));
+        p += 6;
+
+        if (static_cast<size_t>(limite - p) < nbCases * 2) {
+            throw runtime_error("Niveau du pack tronqué");
+        }
+        vector<pair<int, int>>& coords = niveau.pieces[i];
+        coords.reserve(nbCases);
+        for (size_t c = 0; c < nbCases; ++c) {
+            coords.push_back(make_pair(static_cast<int8_t>(p[0]), static_cast<int8_t>(p[1])));
+            p += 2;
+        }
+        niveau.positions[i] = posee ? make_pair(x, y) : make_pair(-1, -1);
+        niveau.posees[i] = posee;
+    }
+
+    size_t nbCellules = niveau.zonesAutorisees.size();
+    if (static_cast<size_t>(limite - p) < 2 * tailleBitmap) {
+        throw runtime_error("Niveau du pack tronqué");
+    }
+    for (size_t c = 0; c < nbCellules; ++c) {
+        niveau.zonesAutorisees[c] = (p[c / 8] >> (c % 8)) & 1;
+        niveau.zonesArrivee[c] = (p[tailleBitmap + c / 8] >> (c % 8)) & 1;
+    }
+
+    return niveau;
+}
+
+unique_ptr<Model> LecteurPack::creerModele(size_t n) const {
+    return unique_ptr<Model>(new Model(lireNiveau(n)));
+}
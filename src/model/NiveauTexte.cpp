@@ -0,0 +1,251 @@
+#include "model/NiveauTexte.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    // Lettres utilisables pour les pièces ('b' et 'r' désignent des zones)
+    const char LETTRES_PIECES[] = "acdefghijklmnopqstuvwxyz";
+    const int NB_LETTRES = 26;
+
+    bool commencePar(const string& ligne, const char* prefixe) {
+        return ligne.compare(0, strlen(prefixe), prefixe) == 0;
+    }
+
+    // Lettre d'une pièce (minuscule), ou '\0' si le caractère n'en est pas une
+    char lettrePiece(char c) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        if (c >= 'a' && c <= 'z' && c != 'b' && c != 'r') {
+            return c;
+        }
+        return '\0';
+    }
+}
+
+// LecteurNiveauxTexte implementation
+LecteurNiveauxTexte::LecteurNiveauxTexte(istream& e)
+    : entree(e), numeroLigne(0), enTeteEnAttente(false) {
+    ligne.reserve(256);
+}
+
+bool LecteurNiveauxTexte::lireLigne() {
+    if (!getline(entree, ligne)) {
+        return false;
+    }
+    ++numeroLigne;
+    size_t fin = ligne.find_last_not_of(" \t\r");
+    ligne.resize(fin == string::npos ? 0 : fin + 1);  // Ne libère jamais la capacité
+    return true;
+}
+
+void LecteurNiveauxTexte::erreur(const string& message) const {
+    throw runtime_error("Ligne " + to_string(numeroLigne) + " : " + message);
+}
+
+bool LecteurNiveauxTexte::lireNiveau(Niveau& niveau) {
+    // Chercher l'en-tête du niveau
+    if (!enTeteEnAttente) {
+        while (true) {
+            if (!lireLigne()) {
+                return false;
+            }
+            if (ligne.empty() || ligne[0] == '#') {
+                continue;
+            }
+            if (commencePar(ligne, "niveau")) {
+                break;
+            }
+            erreur("'niveau' attendu");
+        }
+    }
+    enTeteEnAttente = false;
+
+    // Réinitialiser le niveau en conservant la mémoire déjà allouée
+    niveau.largeur = 0;
+    niveau.hauteur = 0;
+    niveau.zonesAutorisees.clear();
+    niveau.zonesArrivee.clear();
+    niveau.positions.clear();
+    niveau.posees.clear();
+    niveau.pieceADeplacer = 0;
+    niveau.orientationBut = OrientationBut::LIBRE;
+    niveau.pieces.resize(NB_LETTRES);  // Une case par lettre, compactée en fin de lecture
+    for (vector<pair<int, int>>& piece : niveau.pieces) {
+        piece.clear();
+    }
+    char cible = '\0';
+
+    while (lireLigne()) {
+        if (ligne.empty()) {
+            break;
+        }
+        if (ligne[0] == '#') {
+            continue;
+        }
+        if (commencePar(ligne, "niveau")) {
+            enTeteEnAttente = true;
+            break;
+        }
+
+        if (commencePar(ligne, "cible ")) {
+            size_t debut = ligne.find_first_not_of(' ', 6);
+            if (debut == string::npos || debut + 1 != ligne.size() || !lettrePiece(ligne[debut])) {
+                erreur("lettre de pièce attendue après 'cible'");
+            }
+            cible = lettrePiece(ligne[debut]);
+            continue;
+        }
+
+        if (commencePar(ligne, "orientation ")) {
+            size_t debut = ligne.find_first_not_of(' ', 12);
+            if (debut != string::npos && ligne.compare(debut, string::npos, "libre") == 0) {
+                niveau.orientationBut = OrientationBut::LIBRE;
+            } else if (debut != string::npos && ligne.compare(debut, string::npos, "horizontale") == 0) {
+                niveau.orientationBut = OrientationBut::HORIZONTALE;
+            } else if (debut != string::npos && ligne.compare(debut, string::npos, "verticale") == 0) {
+                niveau.orientationBut = OrientationBut::VERTICALE;
+            } else {
+                erreur("orientation attendue : libre, horizontale ou verticale");
+            }
+            continue;
+        }
+
+        // Rangée de la grille
+        if (niveau.largeur == 0) {
+            niveau.largeur = static_cast<int>(ligne.size());
+        } else if (static_cast<int>(ligne.size()) != niveau.largeur) {
+            erreur("toutes les rangées doivent avoir " + to_string(niveau.largeur) + " cases");
+        }
+
+        int y = niveau.hauteur;
+        for (int x = 0; x < niveau.largeur; ++x) {
+            char c = ligne[x];
+            bool autorisee = false;
+            bool arrivee = false;
+
+            if (c == '0' || c == '.') {
+                // Case interdite
+            } else if (c == 'r') {
+                autorisee = true;
+            } else if (c == 'b') {
+                autorisee = true;
+                arrivee = true;
+            } else if (char lettre = lettrePiece(c)) {
+                autorisee = true;
+                arrivee = (c >= 'A' && c <= 'Z');
+                niveau.pieces[lettre - 'a'].push_back(make_pair(x, y));
+            } else {
+                erreur(string("caractère inattendu '") + c + "'");
+            }
+
+            niveau.zonesAutorisees.push_back(autorisee);
+            niveau.zonesArrivee.push_back(arrivee);
+        }
+        ++niveau.hauteur;
+    }
+
+    if (niveau.hauteur == 0) {
+        erreur("niveau sans grille");
+    }
+
+    // Compacter les pièces dans l'ordre alphabétique et les ramener à leur position
+    size_t nbPieces = 0;
+    bool cibleTrouvee = false;
+    for (int lettre = 0; lettre < NB_LETTRES; ++lettre) {
+        vector<pair<int, int>>& cases = niveau.pieces[lettre];
+        if (cases.empty()) {
+            continue;
+        }
+
+        int minX = INT_MAX, minY = INT_MAX;
+        for (const pair<int, int>& cell : cases) {
+            minX = std::min(minX, cell.first);
+            minY = std::min(minY, cell.second);
+        }
+        for (pair<int, int>& cell : cases) {
+            cell.first -= minX;
+            cell.second -= minY;
+        }
+        niveau.positions.push_back(make_pair(minX, minY));
+        niveau.posees.push_back(true);
+
+        if (cible == 'a' + lettre) {
+            niveau.pieceADeplacer = nbPieces;
+            cibleTrouvee = true;
+        }
+        if (static_cast<size_t>(lettre) != nbPieces) {
+            niveau.pieces[nbPieces].swap(cases);  // Échange : les capacités restent réutilisables
+        }
+        ++nbPieces;
+    }
+    niveau.pieces.resize(nbPieces);
+
+    if (nbPieces == 0) {
+        erreur("niveau sans pièce");
+    }
+    if (cible != '\0' && !cibleTrouvee) {
+        erreur(string("la pièce cible '") + cible + "' n'apparaît pas dans la grille");
+    }
+    if (cible == '\0' && nbPieces > 1) {
+        erreur("'cible' obligatoire lorsque le niveau a plusieurs pièces");
+    }
+
+    return true;
+}
+
+// EcrivainNiveauxTexte implementation
+EcrivainNiveauxTexte::EcrivainNiveauxTexte(ostream& s) : sortie(s) {}
+
+void EcrivainNiveauxTexte::ecrireNiveau(const Niveau& niveau) {
+    if (niveau.pieces.size() > sizeof(LETTRES_PIECES) - 1) {
+        throw invalid_argument("Trop de pièces pour le format texte");
+    }
+
+    // Zones d'abord, puis les pièces par-dessus
+    string grille(niveau.largeur * niveau.hauteur, '0');
+    for (int c = 0; c < niveau.largeur * niveau.hauteur; ++c) {
+        if (niveau.zonesArrivee[c]) {
+            grille[c] = 'b';
+        } else if (niveau.zonesAutorisees[c]) {
+            grille[c] = 'r';
+        }
+    }
+
+    for (size_t i = 0; i < niveau.pieces.size(); ++i) {
+        if (!niveau.posees[i]) {
+            throw invalid_argument("Pièce non posée : non représentable au format texte");
+        }
+        for (const pair<int, int>& coord : niveau.pieces[i]) {
+            int x = niveau.positions[i].first + coord.first;
+            int y = niveau.positions[i].second + coord.second;
+            if (x < 0 || x >= niveau.largeur || y < 0 || y >= niveau.hauteur) {
+                throw invalid_argument("Pièce hors de la grille");
+            }
+            char& cellule = grille[y * niveau.largeur + x];
+            if (cellule == '0') {
+                throw invalid_argument("Pièce hors des zones autorisées");
+            }
+            if (cellule != 'b' && cellule != 'r') {
+                throw invalid_argument("Pièces superposées");
+            }
+            char lettre = LETTRES_PIECES[i];
+            cellule = (cellule == 'b') ? static_cast<char>(lettre - 'a' + 'A') : lettre;
+        }
+    }
+
+    sortie << "niveau\n";
+    for (int y = 0; y < niveau.hauteur; ++y) {
+        sortie.write(grille.data() + y * niveau.largeur, niveau.largeur);
+        sortie << '\n';
+    }
+    sortie << "cible " << LETTRES_PIECES[niveau.pieceADeplacer] << '\n';
+    if (niveau.orientationBut == OrientationBut::HORIZONTALE) {
+        sortie << "orientation horizontale\n";
+    } else if (niveau.orientationBut == OrientationBut::VERTICALE) {
+        sortie << "orientation verticale\n";
+    }
+    sortie << '\n';
+}
@@ -0,0 +1,209 @@
+#include "model/NiveauxIntegres.hpp"
+#include <stdexcept>
+
+void configureNiveau1(Model& model) {
+    // Création des pièces
+    vector<pair<int, int>> coords_L = { {0,0}, {0,1}, {0,2}, {1,1} };  // Forme en L
+    model.ajouterPiece(coords_L);
+
+    vector<pair<int, int>> coords_mobile = { {0,0} };  // Pièce mobile
+    model.ajouterPiece(coords_mobile);
+
+    // Placement des pièces
+    model.setPieceActive(0);
+    model.placerPiece(5, 1);
+
+    model.setPieceActive(1);
+    model.placerPiece(6, 6);
+
+    // Store initial positions
+    model.storeInitialPositions();
+
+    // Configuration du niveau
+    model.setZoneArrivee(6, 0);
+    model.setPieceADeplacer(1);
+
+    // Configuration des zones autorisées (chemin vertical)
+    for (int y = 0; y < 8; y++) {
+        model.ajouterZoneAutorisee(6, y);  // Colonne 6 pour le déplacement vertical
+    }
+
+    model.ajouterZoneAutorisee(5, 1);
+    model.ajouterZoneAutorisee(5, 2);
+    model.ajouterZoneAutorisee(5, 3);
+    model.ajouterZoneAutorisee(4, 2);
+}
+
+void configureNiveau2(Model& model) {
+    // Création de la pièce selon le schéma ASCII
+    /*
+    0p0
+    ppp
+    */
+    vector<pair<int, int>> coords_piece = {
+        {1,0},      // p du haut
+        {0,1}, {1,1}, {2,1}  // ppp du bas
+    };
+    model.ajouterPiece(coords_piece);
+
+    // Placement de la pièce à sa position initiale
+    model.setPieceActive(0);
+    model.placerPiece(0, 4);  // Position selon le schéma ASCII (le ppp commence à x=0)
+    model.setPieceADeplacer(0);
+    model.setOrientationBut(OrientationBut::HORIZONTALE);  // La pièce doit arriver couchée
+
+    // Store initial positions
+    model.storeInitialPositions();
+
+    // Configuration des zones but selon le schéma ASCII
+    /*
+    0rrr0
+    bbbrr  <- zones but en forme de L inversé
+    0b0rr
+    */
+    model.ajouterZoneArrivee(0, 1);  // Premier b (à gauche)
+    model.ajouterZoneArrivee(1, 1);  // Deuxième b
+    model.ajouterZoneArrivee(2, 1);  // Troisième b
+    model.ajouterZoneArrivee(1, 2);  // b du bas
+
+    // Configuration des zones autorisées selon le schéma ASCII
+    /*
+    0rrr0
+    rrrrr
+    0r0rr
+    000rr
+    0r0rr
+    rrrrr
+    0rrr0
+    */
+    // Ajouter toutes les zones autorisées pour chaque ligne
+    for (int x = 0; x < 7; x++) {
+        // Première ligne : 0rrr0
+        if (x >= 1 && x <= 3) model.ajouterZoneAutorisee(x, 0);
+
+        // Deuxième ligne : rrrrr
+        if (x <= 4) model.ajouterZoneAutorisee(x, 1);
+
+        // Troisième ligne : 0r0rr
+        if (x == 1 || (x >= 3 && x <= 4)) model.ajouterZoneAutorisee(x, 2);
+
+        // Quatrième ligne : 000rr
+        if (x >= 3 && x <= 4) model.ajouterZoneAutorisee(x, 3);
+
+        // Cinquième ligne : 0r0rr
+        if (x == 1 || (x >= 3 && x <= 4)) model.ajouterZoneAutorisee(x, 4);
+
+        // Sixième ligne : rrrrr
+        if (x <= 4) model.ajouterZoneAutorisee(x, 5);
+
+        // Dernière ligne : 0rrr0
+        if (x >= 1 && x <= 3) model.ajouterZoneAutorisee(x, 6);
+    }
+}
+
+void configureNiveau3(Model& model) {
+    // Création de la pièce à déplacer (forme horizontale)
+    vector<pair<int, int>> coords_piece = {
+        {0,0}  // Pièce simple 1x1
+    };
+    model.ajouterPiece(coords_piece);
+
+    // Création de la pièce en L (obstacle)
+    vector<pair<int, int>> coords_L = {
+        {0,0}, {0,1}, {0,2},  // Partie verticale du L (3 cases)
+        {1,2}                 // Partie horizontale du L
+    };
+    model.ajouterPiece(coords_L);
+
+    // Placement de la pièce à déplacer
+    model.setPieceActive(0);
+    model.placerPiece(0, 5);  // Position du 'p' dans le schéma
+    model.setPieceADeplacer(0);
+
+    // Placement de la pièce en L
+    model.setPieceActive(1);
+    model.placerPiece(2, 3);  // Position initiale du L
+
+    // Store initial positions
+    model.storeInitialPositions();
+
+    // Configuration des zones autorisées selon le schéma ASCII
+    /*
+    000b0
+    000r0
+    00rrr
+    0rarr  <- 'a' représente la pièce en L
+    00ar0
+    praa0
+    000r0
+    */
+
+    // Configuration de la zone but
+    model.ajouterZoneArrivee(3, 0);  // Position du 'b'
+
+    // Ligne 1 : 000r0
+    model.ajouterZoneAutorisee(3, 0);  // Ajout de la zone but comme zone autorisée
+    model.ajouterZoneAutorisee(3, 1);
+
+    // Ligne 2 : 00rrr
+    model.ajouterZoneAutorisee(2, 2);
+    model.ajouterZoneAutorisee(3, 2);
+    model.ajouterZoneAutorisee(4, 2);
+
+    // Ligne 3 : 0rarr
+    model.ajouterZoneAutorisee(1, 3);
+    model.ajouterZoneAutorisee(2, 3);  // Zone pour la pièce en L
+    model.ajouterZoneAutorisee(3, 3);
+    model.ajouterZoneAutorisee(4, 3);
+
+    // Ligne 4 : 00ar0
+    model.ajouterZoneAutorisee(2, 4);  // Zone pour la pièce en L
+    model.ajouterZoneAutorisee(3, 4);
+
+    // Ligne 5 : praa0
+    model.ajouterZoneAutorisee(0, 5);  // Position initiale de la pièce à déplacer
+    model.ajouterZoneAutorisee(1, 5);
+    model.ajouterZoneAutorisee(2, 5);  // Zone pour la pièce en L
+    model.ajouterZoneAutorisee(3, 5);
+
+    // Ligne 6 : 000r0
+    model.ajouterZoneAutorisee(3, 6);
+
+    // Ajout des zones autorisées pour le mouvement vertical de la pièce en L
+    // La pièce en L occupe 4 cases (3 verticales + 1 horizontale)
+    // Il faut autoriser toutes les positions possibles
+    for (int y = 3; y <= 5; y++) {
+        model.ajouterZoneAutorisee(2, y);     // Pour la partie verticale du L
+        model.ajouterZoneAutorisee(3, y);     // Pour la partie horizontale du L
+        if (y > 0) {
+            model.ajouterZoneAutorisee(2, y - 1);  // Pour la case du haut lors du déplacement
+            model.ajouterZoneAutorisee(3, y - 1);  // Pour la partie horizontale lors du déplacement
+        }
+        if (y < 6) {
+            model.ajouterZoneAutorisee(2, y + 1);  // Pour la case du bas lors du déplacement
+            model.ajouterZoneAutorisee(3, y + 1);  // Pour la partie horizontale lors du déplacement
+        }
+    }
+}
+
+void configurerNiveauIntegre(int numero, Model& model) {
+    switch (numero) {
+    case 1:
+        configureNiveau1(model);
+        break;
+    case 2:
+        configureNiveau2(model);
+        break;
+    case 3:
+        configureNiveau3(model);
+        break;
+    default:
+        throw out_of_range("Niveau intégré inexistant");
+    }
+}
+
+Niveau creerNiveauIntegre(int numero) {
+    Model model(TAILLE_NIVEAUX_INTEGRES, TAILLE_NIVEAUX_INTEGRES);
+    configurerNiveauIntegre(numero, model);
+    return model.extraireNiveau();
+}
@@ -32,19 +32,10 @@ void OperateurDeplacement::mapPosition(pair<int, int>& pos) const {
 }
 
 void OperateurDeplacement::visit(PieceConcrete& p) const {
-    // Optimisation : réserve la mémoire pour éviter les réallocations
-    const vector<pair<int, int>>& coords = p.getCoordinates();
-    vector<pair<int, int>> newCoords;
-    newCoords.reserve(coords.size());
-
-    // Applique le déplacement à chaque coordonnée
-    for (const pair<int, int>& coord : coords) {
-        pair<int, int> newCoord = coord;
-        mapPosition(newCoord);
-        newCoords.push_back(newCoord);
-    }
-    // Utilise move pour éviter la copie lors de l'affectation
-    p.coordinates = std::move(newCoords);
+    // Même décalage pour chaque coordonnée : seule l'origine des coordonnées bouge
+    pair<int, int> decalage(0, 0);
+    mapPosition(decalage);
+    p.coordinates.translater(decalage.first, decalage.second);
 }
 
 void OperateurDeplacement::visit(OperateurDeplacement& op) const {
@@ -15,7 +15,7 @@ void OperateurRotation::accept(const PieceOperateur& v) const {
 
 void OperateurRotation::mapPosition(pair<int, int>& pos) const {
     // Trouver le centre de rotation (point de jonction)
-    const vector<pair<int, int>>& coords = source.getCoordinates();
+    const Coordonnees& coords = source.getCoordinates();
     pair<int, int> center = findRotationCenter(coords);
 
     // Coordonnées relatives au centre
@@ -40,11 +40,11 @@ void OperateurRotation::mapPosition(pair<int, int>& pos) const {
 void OperateurRotation::visit(PieceConcrete& p) const {
     try {
         // Trouver le centre de rotation
-        const vector<pair<int, int>>& coords = p.getCoordinates();
+        const Coordonnees& coords = p.getCoordinates();
         pair<int, int> center = findRotationCenter(coords);
 
-        // Appliquer la rotation à chaque coordonnée
-        vector<pair<int, int>> newCoords;
+        // Appliquer la rotation à chaque coordonnée (sans allocation pour une petite pièce)
+        Coordonnees newCoords;
         for (const pair<int, int>& coord : coords) {
             pair<int, int> rotatedCoord = coord;
             
@@ -66,6 +66,9 @@ void OperateurRotation::visit(PieceConcrete& p) const {
 
         // Mettre à jour les coordonnées de la pièce
         p.coordinates = newCoords;
+        uint8_t rotation = (sens == OrientationRotation::HORAIRE) ? PieceConcrete::ROTATION_HORAIRE
+                                                                  : PieceConcrete::ROTATION_ANTIHORAIRE;
+        p.orientation = PieceConcrete::composerOrientations(rotation, p.orientation);
     }
     catch (const exception& e) {
         throw runtime_error("Erreur lors de la visite de PieceConcrete: " + string(e.what()));
@@ -102,7 +105,7 @@ void OperateurRotation::visit(OperateurSymetrie& op) const {
     op.source.accept(*this);
 }
 
-pair<int, int> OperateurRotation::findRotationCenter(const vector<pair<int, int>>& coords) const {
+pair<int, int> OperateurRotation::findRotationCenter(const Coordonnees& coords) const {
     if (coords.empty()) {
         throw invalid_argument("Les coordonnées ne peuvent pas être vides pour trouver le centre de rotation");
     }
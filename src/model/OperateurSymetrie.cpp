@@ -16,7 +16,7 @@ void OperateurSymetrie::accept(const PieceOperateur& v) const {
 
 void OperateurSymetrie::mapPosition(pair<int, int>& pos) const {
     // Récupère les coordonnées pour trouver le centre de symétrie
-    const vector<pair<int, int>>& coords = source.getCoordinates();
+    const Coordonnees& coords = source.getCoordinates();
     const pair<int, int> center = findSymetryCenter(coords);
 
     // Applique la symétrie selon l'axe choisi
@@ -32,12 +32,11 @@ void OperateurSymetrie::mapPosition(pair<int, int>& pos) const {
 }
 
 void OperateurSymetrie::visit(PieceConcrete& p) const {
-    // Optimisation : réserve la mémoire pour éviter les réallocations
-    const vector<pair<int, int>>& coords = p.getCoordinates();
+    // Les nouvelles coordonnées restent dans l'objet pour une petite pièce : aucune allocation
+    const Coordonnees& coords = p.getCoordinates();
     const pair<int, int> center = findSymetryCenter(coords);
 
-    vector<pair<int, int>> newCoords;
-    newCoords.reserve(coords.size());
+    Coordonnees newCoords;
 
     // Applique la symétrie à chaque coordonnée
     for (const pair<int, int>& coord : coords) {
@@ -59,11 +58,13 @@ void OperateurSymetrie::visit(PieceConcrete& p) const {
         newCoords.push_back(symetrieCoord);
     }
 
-    // Utilise move pour éviter la copie lors de l'affectation
-    p.coordinates = std::move(newCoords);
+    p.coordinates = newCoords;
+    uint8_t symetrie = (sens == OrientationSymetrie::VERTICALE) ? PieceConcrete::SYMETRIE_VERTICALE
+                                                                : PieceConcrete::SYMETRIE_HORIZONTALE;
+    p.orientation = PieceConcrete::composerOrientations(symetrie, p.orientation);
 }
 
-pair<int, int> OperateurSymetrie::findSymetryCenter(const vector<pair<int, int>>& coords) const {
+pair<int, int> OperateurSymetrie::findSymetryCenter(const Coordonnees& coords) const {
     // Vérifie que les coordonnées ne sont pas vides
     if (coords.empty()) {
         throw invalid_argument("Les coordonnées ne peuvent pas être vides");
@@ -1,10 +1,32 @@
 #include "model/PieceConcrete.hpp"
 #include "model/PieceOperateur.hpp"
 
-PieceConcrete::PieceConcrete(const vector<pair<int, int>>& coords)
-    : coordinates(coords) {}
+const uint8_t PieceConcrete::NB_ORIENTATIONS;
+const uint8_t PieceConcrete::ROTATION_HORAIRE;
+const uint8_t PieceConcrete::ROTATION_ANTIHORAIRE;
+const uint8_t PieceConcrete::SYMETRIE_VERTICALE;
+const uint8_t PieceConcrete::SYMETRIE_HORIZONTALE;
 
-const vector<pair<int, int>>& PieceConcrete::getCoordinates() const {
+uint8_t PieceConcrete::composerOrientations(uint8_t apres, uint8_t avant) {
+    // (F^sa R^ra)(F^sb R^rb) : une symétrie F inverse le sens des quarts de tour qui la précèdent
+    int ra = apres % 4, sa = apres / 4;
+    int rb = avant % 4, sb = avant / 4;
+    int r = (sb == 0) ? ra + rb : rb - ra + 4;
+    return static_cast<uint8_t>(r % 4 + 4 * (sa ^ sb));
+}
+
+uint8_t PieceConcrete::inverserOrientation(uint8_t orientation) {
+    // Les symétries sont leur propre inverse ; une rotation s'inverse par son opposée
+    if (orientation >= 4) {
+        return orientation;
+    }
+    return static_cast<uint8_t>((4 - orientation) % 4);
+}
+
+PieceConcrete::PieceConcrete(const Coordonnees& coords)
+    : coordinates(coords), orientation(0) {}
+
+const Coordonnees& PieceConcrete::getCoordinates() const {
     return coordinates;
 }
 
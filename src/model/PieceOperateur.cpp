@@ -4,7 +4,7 @@
 PieceOperateur::PieceOperateur(Piece& s, const pair<int, int>& pos)
     : source(s), position(pos) {}
 
-const vector<pair<int, int>>& PieceOperateur::getCoordinates() const {
+const Coordonnees& PieceOperateur::getCoordinates() const {
     return source.getCoordinates();
 }
 
@@ -0,0 +1,68 @@
+#include "model/PreparateurNiveaux.hpp"
+#include <chrono>
+
+namespace {
+    bool estTerminee(const future<unique_ptr<Model>>& preparation) {
+        return preparation.wait_for(chrono::seconds(0)) == future_status::ready;
+    }
+}
+
+const size_t PreparateurNiveaux::MAX_PREPARATIONS;
+
+PreparateurNiveaux::PreparateurNiveaux(Fabrique f) : fabrique(f) {}
+
+PreparateurNiveaux::~PreparateurNiveaux() {
+    // Le destructeur d'un future de std::async attend déjà la fin de la tâche ;
+    // l'écrire explicitement évite toute surprise sur l'ordre de destruction
+    for (auto& entree : enCours) {
+        if (entree.second.valid()) {
+            entree.second.wait();
+        }
+    }
+    for (auto& preparation : abandonnees) {
+        preparation.wait();
+    }
+}
+
+void PreparateurNiveaux::oublierTerminees() {
+    // Détruire un future inachevé bloquerait : seules les constructions finies sont libérées
+    size_t ecriture = 0;
+    for (size_t i = 0; i < abandonnees.size(); ++i) {
+        if (!estTerminee(abandonnees[i])) {
+            abandonnees[ecriture++] = move(abandonnees[i]);
+        }
+    }
+    abandonnees.erase(abandonnees.begin() + ecriture, abandonnees.end());
+}
+
+void PreparateurNiveaux::preparer(int niveau) {
+    for (const auto& entree : enCours) {
+        if (entree.first == niveau) {
+            return;
+        }
+    }
+
+    oublierTerminees();
+    if (enCours.size() + abandonnees.size() >= MAX_PREPARATIONS && !enCours.empty()) {
+        // Remplacer la plus ancienne : son Model est libéré dès qu'il est prêt
+        if (!estTerminee(enCours.front().second)) {
+            abandonnees.push_back(move(enCours.front().second));
+        }
+        enCours.erase(enCours.begin());
+    }
+    if (enCours.size() + abandonnees.size() >= MAX_PREPARATIONS) {
+        return;  // Les threads sont occupés : le niveau sera construit au besoin par prendre()
+    }
+    enCours.push_back(make_pair(niveau, async(launch::async, fabrique, niveau)));
+}
+
+unique_ptr<Model> PreparateurNiveaux::prendre(int niveau) {
+    for (size_t i = 0; i < enCours.size(); ++i) {
+        if (enCours[i].first == niveau) {
+            future<unique_ptr<Model>> preparation = move(enCours[i].second);
+            enCours.erase(enCours.begin() + i);
+            return preparation.get();  // Relance l'exception de la construction, le cas échéant
+        }
+    }
+    return fabrique(niveau);
+}
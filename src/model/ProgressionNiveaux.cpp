@@ -0,0 +1,330 @@
+#include "model/ProgressionNiveaux.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+    const char MAGIC[4] = { 'P', 'C', 'P', 'G' };
+    const uint16_t VERSION = 1;
+    const size_t TAILLE_EN_TETE = 16;
+    const uint32_t CAPACITE_MIN = 1024;        // Première allocation, en niveaux
+    const uint32_t CAPACITE_MAX = 0xFFFFFFC0u; // Plus grand multiple de 64 sur 32 bits
+
+    uint32_t lireU32(const uint8_t* p) {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+             | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    uint64_t lireU64(const uint8_t* p) {
+        return static_cast<uint64_t>(lireU32(p)) | (static_cast<uint64_t>(lireU32(p + 4)) << 32);
+    }
+
+    void ecrireU32(uint8_t* p, uint32_t valeur) {
+        for (int i = 0; i < 4; ++i) {
+            p[i] = static_cast<uint8_t>((valeur >> (8 * i)) & 0xFF);
+        }
+    }
+
+    void ecrireU64(uint8_t* p, uint64_t valeur) {
+        ecrireU32(p, static_cast<uint32_t>(valeur));
+        ecrireU32(p + 4, static_cast<uint32_t>(valeur >> 32));
+    }
+
+    void ecrireEnTete(uint8_t* p, uint32_t capacite) {
+        memset(p, 0, TAILLE_EN_TETE);
+        memcpy(p, MAGIC, 4);
+        p[4] = static_cast<uint8_t>(VERSION & 0xFF);
+        p[5] = static_cast<uint8_t>(VERSION >> 8);
+        ecrireU32(p + 8, capacite);
+    }
+
+    size_t debutRecords(uint32_t capacite) {
+        return TAILLE_EN_TETE + capacite / 8;
+    }
+
+    size_t tailleImage(uint32_t capacite) {
+        return debutRecords(capacite) + static_cast<size_t>(capacite) * 8;
+    }
+
+    // Le meilleur de deux valeurs dont 0 signifie "inconnu"
+    uint32_t meilleur(uint32_t a, uint32_t b) {
+        if (a == 0) return b;
+        if (b == 0) return a;
+        return min(a, b);
+    }
+
+    bool ecrireTout(int descripteur, const uint8_t* octets, size_t taille) {
+        while (taille > 0) {
+            ssize_t ecrit = write(descripteur, octets, taille);
+            if (ecrit < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            octets += ecrit;
+            taille -= static_cast<size_t>(ecrit);
+        }
+        return true;
+    }
+
+    // Rend le renommage durable : l'entrée du répertoire doit aussi atteindre le disque
+    void synchroniserRepertoire(const string& chemin) {
+        size_t separateur = chemin.rfind('/');
+        string repertoire = (separateur == string::npos) ? "." : chemin.substr(0, max<size_t>(separateur, 1));
+        int descripteur = open(repertoire.c_str(), O_RDONLY);
+        if (descripteur >= 0) {
+            fsync(descripteur);
+            close(descripteur);
+        }
+    }
+}
+
+ProgressionNiveaux::ProgressionNiveaux()
+    : projection(nullptr), memoire(TAILLE_EN_TETE), donnees(nullptr), taille(TAILLE_EN_TETE), capacite(0) {
+    ecrireEnTete(memoire.data(), 0);
+    donnees = memoire.data();
+}
+
+ProgressionNiveaux::~ProgressionNiveaux() {
+    fermer();
+}
+
+void ProgressionNiveaux::fermer() {
+    if (projection) {
+        munmap(const_cast<uint8_t*>(projection), taille);
+        projection = nullptr;
+    }
+}
+
+void ProgressionNiveaux::ouvrir(const string& fichier) {
+    lock_guard<mutex> garde(verrou);
+    struct stat infos;
+    if (stat(fichier.c_str(), &infos) == 0) {
+        projeter(fichier);
+        chemin = fichier;
+        return;
+    }
+
+    // Nouveau profil : fichier vide, écrit comme toute autre mise à jour
+    string ancien = chemin;
+    chemin = fichier;
+    try {
+        uint8_t entete[TAILLE_EN_TETE];
+        ecrireEnTete(entete, 0);
+        remplacer(vector<Morceau>{ {entete, TAILLE_EN_TETE} });
+    }
+    catch (...) {
+        chemin = ancien;
+        throw;
+    }
+}
+
+void ProgressionNiveaux::ouvrirProfil(const string& repertoire, const string& profil) {
+    bool valide = !profil.empty() && profil.size() <= 64;
+    for (char c : profil) {
+        valide = valide && (isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_');
+    }
+    if (!valide) {
+        throw invalid_argument("Nom de profil invalide : " + profil);
+    }
+    if (mkdir(repertoire.c_str(), 0755) != 0 && errno != EEXIST) {
+        throw runtime_error("Impossible de créer le répertoire : " + repertoire);
+    }
+    ouvrir(repertoire + "/" + profil + ".progression");
+}
+
+void ProgressionNiveaux::projeter(const string& fichier) {
+    int descripteur = open(fichier.c_str(), O_RDONLY);
+    if (descripteur < 0) {
+        throw runtime_error("Impossible d'ouvrir la progression : " + fichier);
+    }
+
+    struct stat infos;
+    if (fstat(descripteur, &infos) != 0 || static_cast<size_t>(infos.st_size) < TAILLE_EN_TETE) {
+        close(descripteur);
+        throw runtime_error("Progression invalide : " + fichier);
+    }
+    size_t tailleFichier = static_cast<size_t>(infos.st_size);
+
+    // La projection reste valide après la fermeture du descripteur
+    void* p = mmap(nullptr, tailleFichier, PROT_READ, MAP_PRIVATE, descripteur, 0);
+    close(descripteur);
+    if (p == MAP_FAILED) {
+        throw runtime_error("Impossible de projeter la progression : " + fichier);
+    }
+    const uint8_t* octets = static_cast<const uint8_t*>(p);
+
+    uint32_t capaciteFichier = lireU32(octets + 8);
+    bool valide = equal(MAGIC, MAGIC + 4, octets)
+               && (octets[4] | (octets[5] << 8)) == VERSION
+               && capaciteFichier % 64 == 0
+               && tailleImage(capaciteFichier) == tailleFichier;
+    if (!valide) {
+        munmap(p, tailleFichier);
+        throw runtime_error("Progression invalide : " + fichier);
+    }
+
+    fermer();
+    memoire.clear();
+    memoire.shrink_to_fit();
+    projection = octets;
+    donnees = octets;
+    taille = tailleFichier;
+    capacite = capaciteFichier;
+}
+
+void ProgressionNiveaux::remplacer(const vector<Morceau>& morceaux) {
+    if (chemin.empty()) {
+        vector<uint8_t> image;
+        for (const Morceau& morceau : morceaux) {
+            if (morceau.octets) {
+                image.insert(image.end(), morceau.octets, morceau.octets + morceau.taille);
+            } else {
+                image.resize(image.size() + morceau.taille, 0);
+            }
+        }
+        memoire.swap(image);
+        donnees = memoire.data();
+        taille = memoire.size();
+        capacite = lireU32(donnees + 8);
+        return;
+    }
+
+    // Écrire à côté, forcer sur le disque, puis renommer : jamais de progression partielle
+    static const vector<uint8_t> zeros(65536, 0);
+    string temporaire = chemin + ".tmp";
+    int descripteur = open(temporaire.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descripteur < 0) {
+        throw runtime_error("Impossible de créer la progression : " + temporaire);
+    }
+    bool ok = true;
+    for (const Morceau& morceau : morceaux) {
+        if (morceau.octets) {
+            ok = ok && ecrireTout(descripteur, morceau.octets, morceau.taille);
+        } else {
+            for (size_t reste = morceau.taille; ok && reste > 0; reste -= min(reste, zeros.size())) {
+                ok = ecrireTout(descripteur, zeros.data(), min(reste, zeros.size()));
+            }
+        }
+    }
+    ok = ok && fsync(descripteur) == 0;
+    ok = (close(descripteur) == 0) && ok;
+    if (!ok) {
+        remove(temporaire.c_str());
+        throw runtime_error("Erreur d'écriture de la progression : " + temporaire);
+    }
+    if (rename(temporaire.c_str(), chemin.c_str()) != 0) {
+        remove(temporaire.c_str());
+        throw runtime_error("Impossible de renommer la progression : " + chemin);
+    }
+    synchroniserRepertoire(chemin);
+    projeter(chemin);
+}
+
+void ProgressionNiveaux::agrandir(uint32_t niveaux) {
+    uint64_t voulue = max<uint64_t>(max<uint64_t>(niveaux, static_cast<uint64_t>(capacite) * 2), CAPACITE_MIN);
+    uint32_t nouvelle = static_cast<uint32_t>(min<uint64_t>((voulue + 63) / 64 * 64, CAPACITE_MAX));
+
+    // Bitset et records gardent leur contenu, complétés de zéros
+    uint8_t entete[TAILLE_EN_TETE];
+    ecrireEnTete(entete, nouvelle);
+    size_t ajout = nouvelle - capacite;
+    remplacer(vector<Morceau>{
+        {entete, TAILLE_EN_TETE},
+        {donnees + TAILLE_EN_TETE, capacite / 8},
+        {nullptr, ajout / 8},
+        {donnees + debutRecords(capacite), static_cast<size_t>(capacite) * 8},
+        {nullptr, ajout * 8}
+    });
+}
+
+bool ProgressionNiveaux::estTermine(int niveau) const {
+    lock_guard<mutex> garde(verrou);
+    if (niveau < 1 || static_cast<uint32_t>(niveau) > capacite) {
+        return false;
+    }
+    size_t bit = static_cast<size_t>(niveau - 1);
+    return (donnees[TAILLE_EN_TETE + bit / 8] >> (bit % 8)) & 1;
+}
+
+RecordNiveau ProgressionNiveaux::getRecord(int niveau) const {
+    lock_guard<mutex> garde(verrou);
+    RecordNiveau record = {0, 0};
+    if (niveau < 1 || static_cast<uint32_t>(niveau) > capacite) {
+        return record;
+    }
+    const uint8_t* p = donnees + debutRecords(capacite) + static_cast<size_t>(niveau - 1) * 8;
+    record.coups = lireU32(p);
+    record.millisecondes = lireU32(p + 4);
+    return record;
+}
+
+size_t ProgressionNiveaux::compterTermines(int nbNiveaux) const {
+    lock_guard<mutex> garde(verrou);
+    if (nbNiveaux < 1) {
+        return 0;
+    }
+    size_t nbBits = min<size_t>(static_cast<size_t>(nbNiveaux), capacite);
+    size_t total = 0;
+    for (size_t i = 0; i * 64 < nbBits; ++i) {
+        uint64_t mot = lireU64(donnees + TAILLE_EN_TETE + i * 8);
+        if (nbBits - i * 64 < 64) {
+            mot &= (uint64_t(1) << (nbBits - i * 64)) - 1;  // Dernier mot partiel
+        }
+        total += static_cast<size_t>(__builtin_popcountll(mot));
+    }
+    return total;
+}
+
+bool ProgressionNiveaux::enregistrer(int niveau, uint32_t coups, uint32_t millisecondes) {
+    if (niveau < 1 || static_cast<uint32_t>(niveau) > CAPACITE_MAX) {
+        throw invalid_argument("Numéro de niveau invalide : " + to_string(niveau));
+    }
+    lock_guard<mutex> garde(verrou);
+    size_t bit = static_cast<size_t>(niveau - 1);
+    bool termine = false;
+    RecordNiveau ancien = {0, 0};
+    if (static_cast<uint32_t>(niveau) <= capacite) {
+        termine = (donnees[TAILLE_EN_TETE + bit / 8] >> (bit % 8)) & 1;
+        const uint8_t* p = donnees + debutRecords(capacite) + bit * 8;
+        ancien.coups = lireU32(p);
+        ancien.millisecondes = lireU32(p + 4);
+    }
+    RecordNiveau record = {meilleur(ancien.coups, coups), meilleur(ancien.millisecondes, millisecondes)};
+    if (termine && record.coups == ancien.coups && record.millisecondes == ancien.millisecondes) {
+        return false;
+    }
+
+    if (static_cast<uint32_t>(niveau) > capacite) {
+        agrandir(static_cast<uint32_t>(niveau));
+    }
+
+    // Seuls le mot du bitset et le record du niveau changent
+    size_t positionMot = TAILLE_EN_TETE + bit / 64 * 8;
+    size_t positionRecord = debutRecords(capacite) + bit * 8;
+    uint8_t mot[8];
+    uint8_t octetsRecord[8];
+    ecrireU64(mot, lireU64(donnees + positionMot) | (uint64_t(1) << (bit % 64)));
+    ecrireU32(octetsRecord, record.coups);
+    ecrireU32(octetsRecord + 4, record.millisecondes);
+
+    if (chemin.empty()) {
+        memcpy(&memoire[positionMot], mot, 8);
+        memcpy(&memoire[positionRecord], octetsRecord, 8);
+        return true;
+    }
+    remplacer(vector<Morceau>{
+        {donnees, positionMot},
+        {mot, 8},
+        {donnees + positionMot + 8, positionRecord - positionMot - 8},
+        {octetsRecord, 8},
+        {donnees + positionRecord + 8, taille - positionRecord - 8}
+    });
+    return true;
+}
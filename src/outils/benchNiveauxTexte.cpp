@@ -0,0 +1,71 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "model/Model.hpp"
+#include "model/NiveauTexte.hpp"
+#include "model/NiveauxIntegres.hpp"
+
+using namespace std;
+
+// Mesure le temps d'analyse d'un fichier de niveaux au format texte
+// Usage : bench_niveaux_texte [nombre de niveaux] (10000 par défaut)
+int main(int argc, char* argv[]) {
+    int nbNiveaux = (argc > 1) ? atoi(argv[1]) : 10000;
+    const string chemin = "bench_niveaux.txt";
+
+    try {
+        // Générer le fichier à partir des niveaux intégrés, répétés
+        vector<Niveau> modeles;
+        for (int niveau = 1; niveau <= NB_NIVEAUX_INTEGRES; ++niveau) {
+            modeles.push_back(creerNiveauIntegre(niveau));
+        }
+        {
+            ofstream fichier(chemin.c_str());
+            EcrivainNiveauxTexte ecrivain(fichier);
+            for (int i = 0; i < nbNiveaux; ++i) {
+                fichier << "# Niveau " << i + 1 << "\n";
+                ecrivain.ecrireNiveau(modeles[i % modeles.size()]);
+            }
+        }
+
+        // Fichier chargé en mémoire pour ne mesurer que l'analyse
+        ifstream fichier(chemin.c_str());
+        stringstream contenu;
+        contenu << fichier.rdbuf();
+        string texte = contenu.str();
+
+        // Analyse seule
+        istringstream entree1(texte);
+        LecteurNiveauxTexte lecteur1(entree1);
+        Niveau niveau;
+        int lus = 0;
+        chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+        while (lecteur1.lireNiveau(niveau)) {
+            ++lus;
+        }
+        chrono::duration<double, milli> analyse = chrono::steady_clock::now() - debut;
+
+        // Analyse et construction des Model
+        istringstream entree2(texte);
+        LecteurNiveauxTexte lecteur2(entree2);
+        size_t pieces = 0;
+        debut = chrono::steady_clock::now();
+        while (lecteur2.lireNiveau(niveau)) {
+            Model model(niveau);
+            pieces += model.getNbPieces();
+        }
+        chrono::duration<double, milli> construction = chrono::steady_clock::now() - debut;
+
+        cout << lus << " niveaux (" << texte.size() / 1024 << " Ko, " << pieces << " pièces)" << endl;
+        cout << "Analyse seule        : " << analyse.count() << " ms ("
+             << analyse.count() * 1000.0 / lus << " us/niveau)" << endl;
+        cout << "Analyse + Model      : " << construction.count() << " ms ("
+             << construction.count() * 1000.0 / lus << " us/niveau)" << endl;
+        return EXIT_SUCCESS;
+    }
+    catch (const exception& e) {
+        cerr << "Erreur : " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,39 @@
+#include <fstream>
+#include <iostream>
+#include "model/NiveauPack.hpp"
+#include "model/NiveauTexte.hpp"
+#include "model/NiveauxIntegres.hpp"
+
+using namespace std;
+
+// Convertit des niveaux en pack binaire : niveaux intégrés, ou fichier au format texte
+// Usage : creer_pack [chemin du pack] [fichier de niveaux texte]
+int main(int argc, char* argv[]) {
+    string chemin = (argc > 1) ? argv[1] : "resources/niveaux.pack";
+
+    try {
+        EcrivainPack ecrivain;
+        if (argc > 2) {
+            ifstream fichier(argv[2]);
+            if (!fichier) {
+                throw runtime_error(string("Impossible d'ouvrir ") + argv[2]);
+            }
+            LecteurNiveauxTexte lecteur(fichier);
+            Niveau niveau;
+            while (lecteur.lireNiveau(niveau)) {
+                ecrivain.ajouterNiveau(niveau);
+            }
+        } else {
+            for (int niveau = 1; niveau <= NB_NIVEAUX_INTEGRES; ++niveau) {
+                ecrivain.ajouterNiveau(creerNiveauIntegre(niveau));
+            }
+        }
+        ecrivain.ecrire(chemin);
+        cout << ecrivain.getNbNiveaux() << " niveaux écrits dans " << chemin << endl;
+        return EXIT_SUCCESS;
+    }
+    catch (const exception& e) {
+        cerr << "Erreur : " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
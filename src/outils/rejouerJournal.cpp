@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "model/JournalCoups.hpp"
+#include "model/Model.hpp"
+#include "model/NiveauPack.hpp"
+#include "model/NiveauxIntegres.hpp"
+#include "view/CompteurAllocations.hpp"
+
+using namespace std;
+
+namespace {
+    // Même construction que le jeu : niveau du pack, ou niveau intégré sans pack
+    unique_ptr<Model> creerModele(const LecteurPack* pack, int niveau) {
+        if (pack) {
+            if (niveau < 1 || static_cast<size_t>(niveau) > pack->getNbNiveaux()) {
+                throw out_of_range("Niveau absent du pack : " + to_string(niveau));
+            }
+            return pack->creerModele(niveau - 1);
+        }
+        return unique_ptr<Model>(new Model(creerNiveauIntegre(niveau)));
+    }
+}
+
+// Rejoue des journaux de parties sans affichage, aussi vite que possible,
+// et vérifie que chacun retrouve l'état final enregistré
+// Usage : rejouer_journal [--pack FICHIER] [--repetitions N] JOURNAL...
+int main(int argc, char* argv[]) {
+    string cheminPack;
+    int repetitions = 1;
+    vector<string> journaux;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--pack") == 0 && i + 1 < argc) {
+            cheminPack = argv[++i];
+        } else if (strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc) {
+            repetitions = max(1, atoi(argv[++i]));
+        } else {
+            journaux.push_back(argv[i]);
+        }
+    }
+    if (journaux.empty()) {
+        cerr << "Usage : " << argv[0] << " [--pack FICHIER] [--repetitions N] JOURNAL..." << endl;
+        return EXIT_FAILURE;
+    }
+
+    try {
+        unique_ptr<LecteurPack> pack;
+        if (!cheminPack.empty()) {
+            pack.reset(new LecteurPack(cheminPack));
+        }
+
+        size_t nbEchecs = 0;
+        size_t totalCoups = 0;
+        double totalSecondes = 0;
+        unsigned long totalAllocations = 0;  // Pendant le rejeu seul, hors chargement des niveaux
+        for (const string& chemin : journaux) {
+            try {
+                JournalCoups journal = JournalCoups::lire(chemin);
+                BilanRejeu bilan = {0, true, 0};
+                for (int r = 0; r < repetitions && bilan.empreinteValide; ++r) {
+                    unique_ptr<Model> model = creerModele(pack.get(), journal.getNiveau());
+                    model->setSortieMessages(nullptr);  // Pas d'annonce de victoire pendant le rejeu
+                    unsigned long allocationsDebut = getNbAllocations();
+                    BilanRejeu rejeu = journal.rejouer(*model);
+                    totalAllocations += getNbAllocations() - allocationsDebut;
+                    bilan.coups += rejeu.coups;
+                    bilan.secondes += rejeu.secondes;
+                    bilan.empreinteValide = rejeu.empreinteValide;
+                }
+                totalCoups += bilan.coups;
+                totalSecondes += bilan.secondes;
+
+                cout << chemin << " : niveau " << journal.getNiveau() << ", " << journal.getNbCoups()
+                     << " opérations (" << journal.getTaille() << " octets), état final "
+                     << (bilan.empreinteValide ? "conforme" : "DIFFÉRENT") << endl;
+                if (!bilan.empreinteValide) {
+                    ++nbEchecs;
+                }
+            }
+            catch (const exception& e) {
+                cerr << chemin << " : " << e.what() << endl;
+                ++nbEchecs;
+            }
+        }
+
+        cout << totalCoups << " opérations rejouées en " << totalSecondes << " s";
+        if (totalSecondes > 0) {
+            cout << " (" << static_cast<unsigned long>(totalCoups / totalSecondes) << " opérations/s)";
+        }
+        cout << endl;
+        if (totalCoups > 0) {
+            cout << totalAllocations << " allocations pendant le rejeu ("
+                 << static_cast<double>(totalAllocations) / totalCoups << " par opération)" << endl;
+        }
+        return (nbEchecs == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const exception& e) {
+        cerr << "Erreur : " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
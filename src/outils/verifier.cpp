@@ -0,0 +1,438 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "model/JournalCoups.hpp"
+#include "model/Model.hpp"
+#include "model/NiveauPack.hpp"
+#include "model/NiveauxIntegres.hpp"
+
+using namespace std;
+
+namespace {
+    const int NB_PARTIES = 300;          // Parties aléatoires par vérification
+    const int COUPS_PAR_PARTIE = 200;    // Opérations tentées dans chaque partie
+
+    // Cas examinés et cas en défaut d'une vérification
+    struct Bilan {
+        unsigned long cas;
+        unsigned long ecarts;
+    };
+
+    // Modèle d'un niveau intégré, sans messages sur la console
+    unique_ptr<Model> creerModeleMuet(const Niveau& niveau) {
+        unique_ptr<Model> model(new Model(niveau));
+        model->setSortieMessages(nullptr);
+        return model;
+    }
+
+    // État observable du modèle hors pièce active : coups joués, puis chaque pièce
+    vector<long> etat(const Model& model) {
+        vector<long> valeurs;
+        valeurs.push_back(static_cast<long>(model.getNbCoups()));
+        for (size_t i = 0; i < model.getNbPieces(); ++i) {
+            valeurs.push_back(model.isPiecePosee(i));
+            valeurs.push_back(model.getPosition(i).first);
+            valeurs.push_back(model.getPosition(i).second);
+            for (const pair<int, int>& coord : model.getPieceCoords(i)) {
+                valeurs.push_back(coord.first);
+                valeurs.push_back(coord.second);
+            }
+        }
+        return valeurs;
+    }
+
+    // Occupation de la grille recalculée depuis les pièces, au format de Grid::afficher
+    string grilleAttendue(const Model& model) {
+        vector<string> lignes(model.getNbLignes(), string(model.getNbColonnes(), '.'));
+        for (size_t i = 0; i < model.getNbPieces(); ++i) {
+            if (!model.isPiecePosee(i)) {
+                continue;
+            }
+            for (const pair<int, int>& coord : model.getPieceCoords(i)) {
+                int x = model.getPosition(i).first + coord.first;
+                int y = model.getPosition(i).second + coord.second;
+                if (x >= 0 && y >= 0 && x < model.getNbColonnes() && y < model.getNbLignes()) {
+                    lignes[y][x] = 'X';
+                }
+            }
+        }
+        string texte;
+        for (const string& ligne : lignes) {
+            texte += ligne + "\n";
+        }
+        return texte;
+    }
+
+    string grilleAffichee(const Model& model) {
+        ostringstream texte;
+        model.getGrille().afficher(texte);
+        return texte.str();
+    }
+
+    // L'empreinte de l'aperçu est-elle dans la grille et les zones autorisées ?
+    bool dansLesZones(const Model& model, const Apercu& apercu) {
+        for (const pair<int, int>& coord : apercu.coordonnees) {
+            int x = apercu.position.first + coord.first;
+            int y = apercu.position.second + coord.second;
+            if (x < 0 || y < 0 || x >= model.getNbColonnes() || y >= model.getNbLignes() ||
+                !model.estZoneAutorisee(x, y)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Opération tirée au hasard, légale ou non, comme en produit une partie
+    void jouerCoupAleatoire(Model& model, mt19937& hasard) {
+        int tirage = hasard() % 10;
+        if (tirage < 4) {
+            vector<OrientationDeplacement> pas(hasard() % 5);
+            for (OrientationDeplacement& direction : pas) {
+                direction = static_cast<OrientationDeplacement>(hasard() % 4);
+            }
+            model.translaterPiece(pas);
+        } else if (tirage < 5) {
+            model.rotationPiece(static_cast<OrientationRotation>(hasard() % 2));
+        } else if (tirage < 6) {
+            model.symetriePiece(static_cast<OrientationSymetrie>(hasard() % 2));
+        } else if (tirage < 8) {
+            model.setPieceActive(hasard() % model.getNbPieces());
+        } else if (tirage < 9) {
+            int x = static_cast<int>(hasard() % 9) - 1;
+            int y = static_cast<int>(hasard() % 9) - 1;
+            model.placerPiece(x, y);
+        } else if (hasard() % 10 == 0) {
+            model.resetToInitialPositions();
+        } else {
+            model.deplacerPiece(static_cast<OrientationDeplacement>(hasard() % 4));
+        }
+    }
+
+    // Observateur qui compte les notifications reçues
+    class CompteurNotifications : public Observer {
+    public:
+        unsigned long nb = 0;
+        void update() override { ++nb; }
+    };
+
+    // Annuler et rétablir parcourent exactement les états successifs de la partie, la grille
+    // reste celle des pièces, et la compaction borne l'historique sans perdre l'état courant
+    Bilan verifierHistorique(unsigned long graine) {
+        mt19937 hasard(graine);
+        Bilan bilan = {0, 0};
+        for (int partie = 0; partie < NB_PARTIES; ++partie) {
+            unique_ptr<Model> model = creerModeleMuet(creerNiveauIntegre(partie % NB_NIVEAUX_INTEGRES + 1));
+            vector<vector<long>> etats(1, etat(*model));  // États le long de l'historique attendu
+            size_t courant = 0;
+            bool ecart = false;
+            for (int coup = 0; coup < COUPS_PAR_PARTIE; ++coup) {
+                vector<long> avant = etat(*model);
+                jouerCoupAleatoire(*model, hasard);
+                if (etat(*model) != avant) {
+                    etats.resize(courant + 1);
+                    etats.push_back(etat(*model));
+                    ++courant;
+                }
+                if (hasard() % 7 == 0) {
+                    bool annule = model->annuler();
+                    ecart |= annule != (courant > 0);
+                    if (annule && courant > 0) {
+                        ecart |= etat(*model) != etats[--courant];
+                    }
+                }
+                if (hasard() % 13 == 0) {
+                    bool retabli = model->retablir();
+                    ecart |= retabli != (courant + 1 < etats.size());
+                    if (retabli && courant + 1 < etats.size()) {
+                        ecart |= etat(*model) != etats[++courant];
+                    }
+                }
+                ecart |= grilleAffichee(*model) != grilleAttendue(*model);
+            }
+
+            while (model->annuler()) {}
+            ecart |= etat(*model) != etats.front() || grilleAffichee(*model) != grilleAttendue(*model);
+            while (model->retablir()) {}
+            ecart |= etat(*model) != etats.back() || grilleAffichee(*model) != grilleAttendue(*model);
+
+            ++bilan.cas;
+            if (ecart) {
+                ++bilan.ecarts;
+            }
+        }
+
+        // Compaction : longue partie avec un historique limité
+        const size_t LIMITE = 64;
+        unique_ptr<Model> model = creerModeleMuet(creerNiveauIntegre(1));
+        model->setLimiteHistorique(LIMITE);
+        for (int coup = 0; coup < 100 * COUPS_PAR_PARTIE; ++coup) {
+            jouerCoupAleatoire(*model, hasard);
+        }
+        vector<long> etatFinal = etat(*model);
+        bool ecart = model->getTailleHistorique() > LIMITE;
+        while (model->annuler()) {}
+        ecart |= grilleAffichee(*model) != grilleAttendue(*model);
+        while (model->retablir()) {}
+        ecart |= etat(*model) != etatFinal || grilleAffichee(*model) != grilleAttendue(*model);
+        ++bilan.cas;
+        if (ecart) {
+            ++bilan.ecarts;
+        }
+        return bilan;
+    }
+
+    bool memesNiveaux(const Niveau& a, const Niveau& b) {
+        return a.largeur == b.largeur && a.hauteur == b.hauteur && a.pieces == b.pieces &&
+               a.positions == b.positions && a.posees == b.posees &&
+               a.zonesAutorisees == b.zonesAutorisees &&
+               a.zonesArrivee == b.zonesArrivee && a.pieceADeplacer == b.pieceADeplacer &&
+               a.orientationBut == b.orientationBut;
+    }
+
+    // Niveau non représentable dans le format : l'écrivain doit le refuser
+    bool estRefuse(const Niveau& niveau) {
+        EcrivainPack ecrivain;
+        try {
+            ecrivain.ajouterNiveau(niveau);
+        }
+        catch (const invalid_argument&) {
+            return true;
+        }
+        return false;
+    }
+
+    // Pack altéré : le lecteur doit signaler l'erreur au lieu de lire hors du fichier
+    bool estIllisible(const string& chemin, const string& contenu) {
+        {
+            ofstream fichier(chemin.c_str(), ios::binary | ios::trunc);
+            fichier << contenu;
+        }
+        try {
+            LecteurPack(chemin).lireNiveau(0);
+        }
+        catch (const runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    // Un niveau relu depuis un pack est identique à l'original et donne le même Model ;
+    // les niveaux, les packs et les descriptions invalides sont refusés
+    Bilan verifierPack(const string& chemin, unsigned long graine) {
+        mt19937 hasard(graine);
+        Bilan bilan = {0, 0};
+
+        // Niveaux intégrés, puis états de parties aléatoires
+        vector<Niveau> niveaux;
+        for (int n = 1; n <= NB_NIVEAUX_INTEGRES; ++n) {
+            niveaux.push_back(creerNiveauIntegre(n));
+        }
+        for (int partie = 0; partie < NB_PARTIES; ++partie) {
+            unique_ptr<Model> model = creerModeleMuet(niveaux[partie % NB_NIVEAUX_INTEGRES]);
+            for (int coup = 0; coup < COUPS_PAR_PARTIE / 10; ++coup) {
+                jouerCoupAleatoire(*model, hasard);
+            }
+            niveaux.push_back(model->extraireNiveau());
+        }
+
+        EcrivainPack ecrivain;
+        for (const Niveau& niveau : niveaux) {
+            ecrivain.ajouterNiveau(niveau);
+        }
+        ecrivain.ecrire(chemin);
+        {
+            LecteurPack lecteur(chemin);
+            ++bilan.cas;
+            if (lecteur.getNbNiveaux() != niveaux.size()) {
+                ++bilan.ecarts;
+            }
+            for (size_t n = 0; n < niveaux.size() && n < lecteur.getNbNiveaux(); ++n) {
+                ++bilan.cas;
+                if (!memesNiveaux(lecteur.lireNiveau(n), niveaux[n]) ||
+                    lecteur.creerModele(n)->getEmpreinte() != Model(niveaux[n]).getEmpreinte()) {
+                    ++bilan.ecarts;
+                }
+            }
+        }
+
+        // Niveaux que le format ne peut pas représenter
+        const Niveau& base = niveaux[0];
+        vector<Niveau> invalides(5, base);
+        invalides[0].positions[0] = make_pair(40000, 0);
+        invalides[1].positions.pop_back();
+        invalides[2].pieceADeplacer = invalides[2].pieces.size();
+        invalides[3].pieces.resize(70000, vector<pair<int, int>>(1, make_pair(0, 0)));
+        invalides[3].positions.resize(70000, make_pair(-1, -1));
+        invalides[3].posees.resize(70000, false);
+        invalides[4].zonesArrivee.pop_back();
+        for (const Niveau& niveau : invalides) {
+            ++bilan.cas;
+            if (!estRefuse(niveau)) {
+                ++bilan.ecarts;
+            }
+        }
+
+        // Zones incohérentes avec les dimensions : le Model refuse la description
+        Niveau zonesTronquees = base;
+        zonesTronquees.zonesAutorisees.pop_back();
+        ++bilan.cas;
+        try {
+            Model model(zonesTronquees);
+            ++bilan.ecarts;
+        }
+        catch (const invalid_argument&) {
+        }
+
+        // Packs altérés : dimensions démesurées, pièce à déplacer inexistante
+        string contenu;
+        {
+            ifstream fichier(chemin.c_str(), ios::binary);
+            contenu.assign(istreambuf_iterator<char>(fichier), istreambuf_iterator<char>());
+        }
+        size_t debut = static_cast<uint8_t>(contenu[12]) | (static_cast<uint8_t>(contenu[13]) << 8);
+        string demesure = contenu;
+        demesure.replace(debut, 4, 4, static_cast<char>(0xFF));
+        string sansPiece = contenu;
+        sansPiece[debut + 7] = static_cast<char>(0xFF);
+        ++bilan.cas;
+        if (!estIllisible(chemin, demesure)) {
+            ++bilan.ecarts;
+        }
+        ++bilan.cas;
+        if (!estIllisible(chemin, sansPiece)) {
+            ++bilan.ecarts;
+        }
+
+        remove(chemin.c_str());
+        return bilan;
+    }
+
+    // Chaque partie enregistrée se rejoue à l'identique : même état final, même nombre de coups
+    Bilan verifierJournal(unsigned long graine) {
+        mt19937 hasard(graine);
+        Bilan bilan = {0, 0};
+        for (int partie = 0; partie < NB_PARTIES; ++partie) {
+            int niveau = partie % NB_NIVEAUX_INTEGRES + 1;
+            JournalCoups journal(niveau);
+            unique_ptr<Model> model = creerModeleMuet(creerNiveauIntegre(niveau));
+            model->setJournal(&journal);
+            for (int coup = 0; coup < COUPS_PAR_PARTIE; ++coup) {
+                jouerCoupAleatoire(*model, hasard);
+            }
+            model->setJournal(nullptr);
+
+            unique_ptr<Model> rejoue = creerModeleMuet(creerNiveauIntegre(niveau));
+            BilanRejeu rejeu = journal.rejouer(*rejoue);
+            ++bilan.cas;
+            if (journal.getEmpreinteFinale() != model->getEmpreinte() || !rejeu.empreinteValide ||
+                rejoue->getNbCoups() != model->getNbCoups()) {
+                ++bilan.ecarts;
+            }
+        }
+        return bilan;
+    }
+
+    // Un aperçu ne modifie ni ne notifie le modèle, et annonce exactement le résultat de l'opération
+    Bilan verifierApercus(unsigned long graine) {
+        mt19937 hasard(graine);
+        Bilan bilan = {0, 0};
+        for (int partie = 0; partie < NB_PARTIES; ++partie) {
+            unique_ptr<Model> model = creerModeleMuet(creerNiveauIntegre(partie % NB_NIVEAUX_INTEGRES + 1));
+            CompteurNotifications compteur;
+            model->addObserver(&compteur);
+            for (int requete = 0; requete < COUPS_PAR_PARTIE; ++requete) {
+                size_t index = hasard() % model->getNbPieces();
+                int operation = hasard() % 4;
+                int x = static_cast<int>(hasard() % 10) - 1;
+                int y = static_cast<int>(hasard() % 10) - 1;
+                OrientationDeplacement direction = static_cast<OrientationDeplacement>(hasard() % 4);
+                OrientationRotation rotation = static_cast<OrientationRotation>(hasard() % 2);
+                OrientationSymetrie symetrie = static_cast<OrientationSymetrie>(hasard() % 2);
+
+                uint64_t empreinte = model->getEmpreinte();
+                compteur.nb = 0;
+                Apercu apercu;
+                switch (operation) {
+                case 0: apercu = model->apercuPlacement(index, x, y); break;
+                case 1: apercu = model->apercuDeplacement(index, direction); break;
+                case 2: apercu = model->apercuRotation(index, rotation); break;
+                default: apercu = model->apercuSymetrie(index, symetrie); break;
+                }
+                bool ecart = compteur.nb != 0 || model->getEmpreinte() != empreinte ||
+                             apercu.dansLesZones != dansLesZones(*model, apercu);
+
+                Model::Instantane avant = model->prendreInstantane();
+                model->setPieceActive(index);
+                bool accepte;
+                switch (operation) {
+                case 0: accepte = model->placerPiece(x, y); break;
+                case 1: accepte = model->deplacerPiece(direction); break;
+                case 2: accepte = model->rotationPiece(rotation); break;
+                default: accepte = model->symetriePiece(symetrie); break;
+                }
+                if (accepte != apercu.valide ||
+                    (accepte && (model->getPosition(index) != apercu.position ||
+                                 model->getPieceCoords(index) != apercu.coordonnees))) {
+                    ecart = true;
+                }
+
+                ++bilan.cas;
+                if (ecart) {
+                    ++bilan.ecarts;
+                }
+                if (hasard() % 2) {
+                    model->restaurer(avant);
+                }
+            }
+            model->removeObserver(&compteur);
+        }
+        return bilan;
+    }
+
+    bool afficherBilan(const string& nom, const Bilan& bilan) {
+        cout << nom << " : " << bilan.cas << " cas, " << bilan.ecarts << " écarts" << endl;
+        return bilan.ecarts == 0;
+    }
+}
+
+// Vérifie le modèle sur des parties aléatoires reproductibles : annulation et compaction de l'historique,
+// équivalence et validation des packs de niveaux, rejeu des journaux, aperçus des coups
+// Usage : verifier_modele [--graine N] [--pack FICHIER]
+int main(int argc, char* argv[]) {
+    unsigned long graine = 2024;
+    string cheminPack = "verifier_modele.pack";  // Pack temporaire, supprimé à la fin
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--graine") == 0 && i + 1 < argc) {
+            graine = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--pack") == 0 && i + 1 < argc) {
+            cheminPack = argv[++i];
+        } else {
+            cerr << "Usage : " << argv[0] << " [--graine N] [--pack FICHIER]" << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    try {
+        // Chaque vérification tire ses parties de sa propre suite, issue de la même graine
+        bool conforme = afficherBilan("Historique", verifierHistorique(graine));
+        conforme &= afficherBilan("Packs de niveaux", verifierPack(cheminPack, graine));
+        conforme &= afficherBilan("Rejeu des journaux", verifierJournal(graine));
+        conforme &= afficherBilan("Aperçus des coups", verifierApercus(graine));
+        cout << (conforme ? "Modèle conforme" : "ÉCARTS DÉTECTÉS") << " (graine " << graine << ")" << endl;
+        return conforme ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const exception& e) {
+        remove(cheminPack.c_str());
+        cerr << "Erreur : " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+#include "model/NiveauPack.hpp"
+#include "view/RenduLogiciel.hpp"
+
+using namespace std;
+
+// Rend chaque niveau d'un pack en vignette, en parallèle sur tous les coeurs
+// Usage : vignettes [pack] [répertoire] [taille de case] [threads] [--ppm]
+int main(int argc, char* argv[]) {
+    vector<string> arguments;
+    bool ppm = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--ppm") == 0) {
+            ppm = true;
+        } else {
+            arguments.push_back(argv[i]);
+        }
+    }
+    string cheminPack = (arguments.size() > 0) ? arguments[0] : "resources/niveaux.pack";
+    string repertoire = (arguments.size() > 1) ? arguments[1] : "vignettes";
+    int tailleCase = (arguments.size() > 2) ? atoi(arguments[2].c_str()) : 8;
+    unsigned nbThreads = (arguments.size() > 3) ? static_cast<unsigned>(atoi(arguments[3].c_str()))
+                                                : thread::hardware_concurrency();
+    nbThreads = max(1u, nbThreads);
+
+    try {
+        LecteurPack pack(cheminPack);
+        if (mkdir(repertoire.c_str(), 0755) != 0 && errno != EEXIST) {
+            throw runtime_error("Impossible de créer le répertoire : " + repertoire);
+        }
+
+        // Les threads se partagent les niveaux un par un : la projection du pack est en lecture seule
+        size_t nbNiveaux = pack.getNbNiveaux();
+        atomic<size_t> suivant(0);
+        atomic<size_t> nbEchecs(0);
+        mutex verrouErreur;
+        string premiereErreur;
+        chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+
+        vector<thread> threads;
+        for (unsigned t = 0; t < min<size_t>(nbThreads, max<size_t>(nbNiveaux, 1)); ++t) {
+            threads.push_back(thread([&] {
+                char nom[48];
+                for (size_t n = suivant++; n < nbNiveaux; n = suivant++) {
+                    try {
+                        ImageRGB image = rendreNiveau(pack.lireNiveau(n), tailleCase);
+                        snprintf(nom, sizeof(nom), "/niveau_%05zu.%s", n + 1, ppm ? "ppm" : "png");
+                        if (ppm) {
+                            image.ecrirePPM(repertoire + nom);
+                        } else {
+                            image.ecrirePNG(repertoire + nom);
+                        }
+                    }
+                    catch (const exception& e) {
+                        ++nbEchecs;
+                        lock_guard<mutex> verrou(verrouErreur);
+                        if (premiereErreur.empty()) {
+                            premiereErreur = "niveau " + to_string(n + 1) + " : " + e.what();
+                        }
+                    }
+                }
+            }));
+        }
+        for (thread& t : threads) {
+            t.join();
+        }
+
+        double secondes = chrono::duration<double>(chrono::steady_clock::now() - debut).count();
+        cout << nbNiveaux - nbEchecs << " vignettes écrites dans " << repertoire << " en " << secondes
+             << " s (" << threads.size() << " threads)" << endl;
+        if (nbEchecs > 0) {
+            cerr << "Erreur : " << nbEchecs << " niveaux non rendus, dont " << premiereErreur << endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    catch (const exception& e) {
+        cerr << "Erreur : " << e.what() << endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,154 @@
+#include "view/CacheVignettes.hpp"
+#include "view/RenduLogiciel.hpp"
+#include <algorithm>
+
+namespace {
+    const int BORD_VIGNETTE = 4;  // Contour de RenduLogiciel (2 pixels de chaque côté)
+    const int CASE_MIN = 4;
+    const int CASE_MAX = 24;
+}
+
+CacheVignettes::CacheVignettes(Source s, size_t c, Vector2u t)
+    : source(s),
+    capacite(max<size_t>(c, 1)),
+    tailleMax(t),
+    enCours(0),
+    arret(false) {
+    // Démarré en dernier : tous les membres partagés sont construits
+    travailleur = thread(&CacheVignettes::boucleRendu, this);
+}
+
+CacheVignettes::~CacheVignettes() {
+    {
+        lock_guard<mutex> garde(verrou);
+        arret = true;
+        file.clear();
+    }
+    reveil.notify_one();
+    travailleur.join();
+}
+
+const Texture* CacheVignettes::obtenir(int niveau) {
+    unordered_map<int, Entree>::iterator it = textures.find(niveau);
+    if (it == textures.end()) {
+        return nullptr;
+    }
+    parRecence.splice(parRecence.begin(), parRecence, it->second.recence);
+    return &it->second.texture;
+}
+
+void CacheVignettes::demander(const vector<int>& niveaux) {
+    {
+        lock_guard<mutex> garde(verrou);
+        file.clear();
+        for (int niveau : niveaux) {
+            if (niveau == enCours || textures.count(niveau) || echecs.count(niveau)) {
+                continue;
+            }
+            bool dejaRendu = false;
+            for (const Rendu& rendu : rendus) {
+                dejaRendu = dejaRendu || rendu.niveau == niveau;
+            }
+            if (!dejaRendu) {
+                file.push_back(niveau);
+            }
+        }
+        if (file.empty()) {
+            return;
+        }
+    }
+    reveil.notify_one();
+}
+
+bool CacheVignettes::integrerRendues() {
+    vector<Rendu> arrives;
+    {
+        lock_guard<mutex> garde(verrou);
+        arrives.swap(rendus);
+    }
+
+    for (Rendu& rendu : arrives) {
+        if (rendu.rgba.empty() || textures.count(rendu.niveau)) {
+            if (rendu.rgba.empty()) {
+                echecs.insert(rendu.niveau);
+            }
+            continue;
+        }
+
+        Entree& entree = textures[rendu.niveau];
+        if (!entree.texture.create(rendu.largeur, rendu.hauteur)) {
+            textures.erase(rendu.niveau);
+            echecs.insert(rendu.niveau);
+            continue;
+        }
+        entree.texture.update(rendu.rgba.data());
+        entree.texture.setSmooth(true);  // Les vignettes sont réduites à l'affichage
+        parRecence.push_front(rendu.niveau);
+        entree.recence = parRecence.begin();
+
+        // Évincer la vignette affichée le moins récemment
+        if (textures.size() > capacite) {
+            textures.erase(parRecence.back());
+            parRecence.pop_back();
+        }
+    }
+    return !arrives.empty();
+}
+
+bool CacheVignettes::enAttente() const {
+    lock_guard<mutex> garde(verrou);
+    return !file.empty() || enCours != 0 || !rendus.empty();
+}
+
+void CacheVignettes::boucleRendu() {
+    unique_lock<mutex> garde(verrou);
+    while (true) {
+        reveil.wait(garde, [this] { return arret || !file.empty(); });
+        if (arret) {
+            return;
+        }
+        enCours = file.front();
+        file.pop_front();
+
+        // Rendu hors verrou : le menu peut remplacer la file pendant ce temps
+        garde.unlock();
+        Rendu rendu = rendre(enCours);
+        garde.lock();
+
+        rendus.push_back(move(rendu));
+        enCours = 0;
+    }
+}
+
+CacheVignettes::Rendu CacheVignettes::rendre(int niveau) const {
+    Rendu rendu = {niveau, 0, 0, vector<Uint8>()};
+    try {
+        Niveau description = source(niveau);
+        if (description.largeur <= 0 || description.hauteur <= 0) {
+            return rendu;
+        }
+
+        // Plus grande taille de case qui tient dans la vignette
+        int tailleCase = min((static_cast<int>(tailleMax.x) - BORD_VIGNETTE) / description.largeur,
+                             (static_cast<int>(tailleMax.y) - BORD_VIGNETTE) / description.hauteur);
+        tailleCase = max(CASE_MIN, min(CASE_MAX, tailleCase));
+        ImageRGB image = rendreNiveau(description, tailleCase);
+
+        // SFML attend du RGBA
+        const vector<uint8_t>& rgb = image.getPixels();
+        rendu.largeur = static_cast<unsigned>(image.getLargeur());
+        rendu.hauteur = static_cast<unsigned>(image.getHauteur());
+        rendu.rgba.resize(rgb.size() / 3 * 4);
+        for (size_t i = 0, j = 0; i < rgb.size(); i += 3, j += 4) {
+            rendu.rgba[j] = rgb[i];
+            rendu.rgba[j + 1] = rgb[i + 1];
+            rendu.rgba[j + 2] = rgb[i + 2];
+            rendu.rgba[j + 3] = 255;
+        }
+    }
+    catch (const exception&) {
+        // Niveau illisible : pas de vignette, le menu garde la case vide
+        rendu.rgba.clear();
+    }
+    return rendu;
+}
@@ -0,0 +1,65 @@
+#include "view/Camera.hpp"
+#include <algorithm>
+
+namespace {
+    const float MAX_ZOOM = 4.0f;
+    const float MIN_ZOOM = 0.1f;  // Cases de 4 pixels au plus loin
+}
+
+Camera::Camera() : worldSize(0, 0), center(0, 0), zoom(1), minZoom(1), revision(0) {}
+
+void Camera::setup(const FloatRect& p, const Vector2f& windowSize, const Vector2f& world) {
+    pane = p;
+    worldSize = world;
+
+    // Dézoomer jusqu'à voir tout le plateau, sans descendre sous MIN_ZOOM
+    float fit = std::min(pane.width / worldSize.x, pane.height / worldSize.y);
+    minZoom = std::max(MIN_ZOOM, std::min(1.0f, fit));
+
+    view.setViewport(FloatRect(pane.left / windowSize.x, pane.top / windowSize.y,
+                               pane.width / windowSize.x, pane.height / windowSize.y));
+    reset();
+}
+
+void Camera::reset() {
+    zoom = 1;
+    center = Vector2f(worldSize.x / 2, worldSize.y / 2);
+    apply();
+}
+
+void Camera::centerOn(const Vector2f& world) {
+    center = world;
+    apply();
+}
+
+void Camera::pan(const Vector2f& pixels) {
+    center -= pixels / zoom;
+    apply();
+}
+
+void Camera::zoomAt(float factor, const Vector2f& worldAnchor) {
+    float ancien = zoom;
+    zoom = std::max(minZoom, std::min(MAX_ZOOM, zoom * factor));
+    center = worldAnchor + (center - worldAnchor) * (ancien / zoom);
+    apply();
+}
+
+FloatRect Camera::getVisibleArea() const {
+    Vector2f size = view.getSize();
+    return FloatRect(view.getCenter().x - size.x / 2, view.getCenter().y - size.y / 2, size.x, size.y);
+}
+
+void Camera::apply() {
+    zoom = std::max(minZoom, std::min(MAX_ZOOM, zoom));
+    Vector2f size(pane.width / zoom, pane.height / zoom);
+
+    // Plateau plus petit que la vue : centré ; sinon la vue reste sur le plateau
+    center.x = (size.x >= worldSize.x) ? worldSize.x / 2
+             : std::max(size.x / 2, std::min(worldSize.x - size.x / 2, center.x));
+    center.y = (size.y >= worldSize.y) ? worldSize.y / 2
+             : std::max(size.y / 2, std::min(worldSize.y - size.y / 2, center.y));
+
+    view.setSize(size);
+    view.setCenter(center);
+    ++revision;
+}
@@ -0,0 +1,42 @@
+#include "view/CompteurAllocations.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<unsigned long> nbAllocations(0);
+}
+
+void* operator new(std::size_t taille) {
+    nbAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (taille == 0) {
+        taille = 1;
+    }
+    while (true) {
+        void* memoire = std::malloc(taille);
+        if (memoire) {
+            return memoire;
+        }
+        std::new_handler gestionnaire = std::get_new_handler();
+        if (!gestionnaire) {
+            throw std::bad_alloc();
+        }
+        gestionnaire();
+    }
+}
+
+void* operator new[](std::size_t taille) {
+    return ::operator new(taille);
+}
+
+void operator delete(void* memoire) noexcept {
+    std::free(memoire);
+}
+
+void operator delete[](void* memoire) noexcept {
+    std::free(memoire);
+}
+
+unsigned long getNbAllocations() {
+    return nbAllocations.load(std::memory_order_relaxed);
+}
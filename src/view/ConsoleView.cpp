@@ -1,131 +1,160 @@
 #include "view/ConsoleView.hpp"
+#include <algorithm>
 #include <sstream>
 #include <limits>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace {
+    // Nombre de lignes du terminal (24 si la sortie n'en est pas un)
+    int hauteurTerminal() {
+        winsize taille;
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &taille) == 0 && taille.ws_row > 0) {
+            return taille.ws_row;
+        }
+        return 24;
+    }
+}
 
 ConsoleView::ConsoleView(Model& m) : model(m) {
     // S'enregistrer comme observateur du modèle
     model.addObserver(this);
 }
 
-void ConsoleView::afficherGrilleNumerotee() const {
-    cout << "\n  ";
-    // Affichage des numéros de colonne
-    for (int i = 0; i < 8; i++) {
-        cout << i << " ";
-    }
-    cout << "\n  ";
-    for (int i = 0; i < 8; i++) {
-        cout << "--";
+void ConsoleView::composerGrilleNumerotee() {
+    int largeur = model.getNbColonnes();
+    int hauteur = model.getNbLignes();
+
+    // Marge des numéros de ligne, une ou deux lignes d'en-tête selon la largeur
+    int marge = static_cast<int>(to_string(max(hauteur - 1, 0)).size()) + 1;
+    int lignesEnTete = (largeur > 10) ? 2 : 1;
+    int haut = lignesEnTete + 1;
+    tampon.redimensionner(marge + 2 * largeur, haut + hauteur);
+    tampon.vider();
+
+    // Numéros de colonne (dizaines au-dessus des unités) puis séparateur
+    for (int x = 0; x < largeur; ++x) {
+        int colonne = marge + 2 * x;
+        if (lignesEnTete == 2 && x >= 10) {
+            tampon.ecrire(colonne, 0, static_cast<char>('0' + (x / 10) % 10));
+        }
+        tampon.ecrire(colonne, lignesEnTete - 1, static_cast<char>('0' + x % 10));
+        tampon.ecrireTexte(colonne, lignesEnTete, "--");
     }
-    cout << endl;
-
-    // Affichage de la grille avec numéros de ligne
-    string gridStr;
-    stringstream ss;
-    model.getGrille().afficher(ss);
-    gridStr = ss.str();
 
-    // Position de la zone d'arrivée
-    pair<int, int> zone = model.getZoneArrivee();
-
-    // Récupérer les informations sur les pièces
-    size_t pieceADeplacer = model.getPieceADeplacer();
+    // Occupant de chaque case, en un seul passage sur les pièces
+    vector<int> occupation(largeur * hauteur, -1);
+    for (size_t p = 0; p < model.getNbPieces(); ++p) {
+        if (!model.isPiecePosee(p)) continue;
+        pair<int, int> pos = model.getPosition(p);
+        for (const pair<int, int>& coord : model.getPieceCoords(p)) {
+            int px = pos.first + coord.first;
+            int py = pos.second + coord.second;
+            if (px >= 0 && px < largeur && py >= 0 && py < hauteur) {
+                occupation[py * largeur + px] = static_cast<int>(p);
+            }
+        }
+    }
 
-    int ligne = 0;
-    size_t pos = 0;
-    while ((pos = gridStr.find('\n')) != string::npos) {
-        cout << ligne << "|";
-        string ligneCourante = gridStr.substr(0, pos);
+    int pieceADeplacer = static_cast<int>(model.getPieceADeplacer());
+    for (int y = 0; y < hauteur; ++y) {
+        string numero = to_string(y);
+        tampon.ecrireTexte(marge - 1 - static_cast<int>(numero.size()), haut + y, numero);
+        tampon.ecrire(marge - 1, haut + y, '|');
 
-        // Parcourir chaque caractère de la ligne
-        for (size_t i = 0; i < ligneCourante.length(); ++i) {
-            if (static_cast<int>(i) == zone.first && ligne == zone.second) {
+        for (int x = 0; x < largeur; ++x) {
+            int occupant = occupation[y * largeur + x];
+            if (model.estZoneArrivee(x, y)) {
                 // Case d'arrivée
-                cout << ROUGE << (ligneCourante[i] == 'X' ? 'X' : 'O') << RESET;
-            } else if (ligneCourante[i] == 'X') {
-                // Trouver quelle pièce occupe cette position
-                bool estPieceADeplacer = false;
-                for (size_t p = 0; p < model.getNbPieces(); ++p) {
-                    if (model.isPiecePosee(p)) {
-                        pair<int, int> pos = model.getPosition(p);
-                        const vector<pair<int, int>>& coords = model.getPieceCoords(p);
-                        for (const pair<int, int>& coord : coords) {
-                            int px = pos.first + coord.first;
-                            int py = pos.second + coord.second;
-                            if (px == static_cast<int>(i) && py == ligne) {
-                                if (p == pieceADeplacer) {
-                                    estPieceADeplacer = true;
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
-                // Afficher en vert si c'est la pièce à déplacer, en jaune sinon
-                cout << (estPieceADeplacer ? VERT : JAUNE) << 'X' << RESET;
+                tampon.ecrire(marge + 2 * x, haut + y, occupant != -1 ? 'X' : 'O', CouleurConsole::ROUGE);
+            } else if (occupant != -1) {
+                // En vert si c'est la pièce à déplacer, en jaune sinon
+                tampon.ecrire(marge + 2 * x, haut + y, 'X',
+                              occupant == pieceADeplacer ? CouleurConsole::VERT : CouleurConsole::JAUNE);
             } else {
-                cout << ligneCourante[i];  // Case vide
+                tampon.ecrire(marge + 2 * x, haut + y, '.');  // Case vide
             }
         }
-        cout << endl;
+    }
+}
 
-        gridStr.erase(0, pos + 1);
-        ligne++;
+void ConsoleView::afficherEcran() {
+    composerGrilleNumerotee();
+
+    // Sous la grille : zone d'arrivée, pièces, menu et saisies de l'utilisateur
+    // Si tout ne tient pas à l'écran, le terminal défile et la grille doit être réécrite
+    int lignesSousGrille = static_cast<int>(model.getNbPieces()) + 26;
+    if (tampon.getHauteur() + lignesSousGrille > hauteurTerminal()) {
+        tampon.invalider();
     }
 
-    // Afficher la position de la zone d'arrivée
-    cout << "\nZone d'arrivée : " << ROUGE << "(" << zone.first << "," << zone.second << ")" << RESET << endl;
+    string sortie;
+    tampon.rendre(sortie);
+    sortie += "\033[" + to_string(tampon.getHauteur() + 1) + ";1H\033[J";
+
+    // Position de la zone d'arrivée
+    ostringstream suite;
+    pair<int, int> zone = model.getZoneArrivee();
+    suite << "\nZone d'arrivée : " << ROUGE << "(" << zone.first << "," << zone.second << ")" << RESET << '\n';
+    afficherPieces(suite);
+    afficherMenu(suite);
+    sortie += suite.str();
+
+    // Une seule écriture pour toute la frame
+    cout << sortie << flush;
 }
 
-void ConsoleView::afficherPieces() const {
+void ConsoleView::afficherPieces(ostream& os) const {
     try {
-        cout << "\nPièces disponibles :" << endl;
+        os << "\nPièces disponibles :" << '\n';
         for (size_t i = 0; i < model.getNbPieces(); ++i) {
             // Choisir la couleur en fonction du type de pièce
             string couleur = (i == model.getPieceADeplacer() ? VERT : JAUNE);
 
-            cout << couleur << "Pièce " << i << " : ";
+            os << couleur << "Pièce " << i << " : ";
             if (i == model.getPieceActiveIndex()) {
-                cout << "(Active) ";
+                os << "(Active) ";
             }
             if (i == model.getPieceADeplacer()) {
-                cout << "(À déplacer vers la zone d'arrivée) ";
+                os << "(À déplacer vers la zone d'arrivée) ";
             }
 
             if (model.isPiecePosee(i)) {
                 pair<int, int> pos = model.getPosition(i);
-                cout << "Position (" << pos.first << "," << pos.second << ") ";
+                os << "Position (" << pos.first << "," << pos.second << ") ";
             } else {
-                cout << "Non placée ";
+                os << "Non placée ";
             }
 
-            cout << "Coordonnées : ";
-            const vector<pair<int, int>>& coords = model.getPieceCoords(i);
+            os << "Coordonnées : ";
+            const Coordonnees& coords = model.getPieceCoords(i);
             for (const pair<int, int>& coord : coords) {
-                cout << "(" << coord.first << "," << coord.second << ") ";
+                os << "(" << coord.first << "," << coord.second << ") ";
             }
-            cout << RESET << endl;
+            os << RESET << '\n';
         }
 
         if (model.isPartieGagnee()) {
-            cout << "\n" << VERT << "🎉 VICTOIRE ! La pièce a atteint la zone d'arrivée ! 🎉" << RESET << endl;
+            os << "\n" << VERT << "🎉 VICTOIRE ! La pièce a atteint la zone d'arrivée ! 🎉" << RESET << '\n';
         }
     }
     catch (const runtime_error& e) {
-        cout << ROUGE << "Erreur : " << e.what() << RESET << endl;
+        os << ROUGE << "Erreur : " << e.what() << RESET << '\n';
     }
 }
 
-void ConsoleView::afficherMenu() const {
-    cout << "\n=== Menu Principal ===" << endl;
-    cout << "1. Placer une pièce" << endl;
-    cout << "2. Effectuer une rotation" << endl;
-    cout << "3. Effectuer une symétrie" << endl;
-    cout << "4. Déplacer une pièce" << endl;
-    cout << "5. Changer de pièce active" << endl;
-    cout << "6. Effacer la grille" << endl;
-    cout << "7. Quitter" << endl;
-    cout << "\nVotre choix : ";
+void ConsoleView::afficherMenu(ostream& os) const {
+    os << "\n=== Menu Principal ===" << '\n';
+    os << "1. Placer une pièce" << '\n';
+    os << "2. Effectuer une rotation" << '\n';
+    os << "3. Effectuer une symétrie" << '\n';
+    os << "4. Déplacer une pièce" << '\n';
+    os << "5. Changer de pièce active" << '\n';
+    os << "6. Effacer la grille" << '\n';
+    os << "7. Annuler le dernier coup" << '\n';
+    os << "8. Rétablir le coup annulé" << '\n';
+    os << "9. Quitter" << '\n';
+    os << "\nVotre choix : ";
 }
 
 int ConsoleView::lireChoix() const {
@@ -141,16 +170,18 @@ int ConsoleView::lireChoix() const {
 
 pair<int, int> ConsoleView::lireCoordonnees() const {
     int x, y;
-    cout << "Position X (0-7) : ";
-    while (!(cin >> x) || x < 0 || x > 7) {
-        cout << "Position X invalide. Entrez un nombre entre 0 et 7 : ";
+    int maxX = model.getNbColonnes() - 1;
+    int maxY = model.getNbLignes() - 1;
+    cout << "Position X (0-" << maxX << ") : ";
+    while (!(cin >> x) || x < 0 || x > maxX) {
+        cout << "Position X invalide. Entrez un nombre entre 0 et " << maxX << " : ";
         cin.clear();
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
     }
 
-    cout << "Position Y (0-7) : ";
-    while (!(cin >> y) || y < 0 || y > 7) {
-        cout << "Position Y invalide. Entrez un nombre entre 0 et 7 : ";
+    cout << "Position Y (0-" << maxY << ") : ";
+    while (!(cin >> y) || y < 0 || y > maxY) {
+        cout << "Position Y invalide. Entrez un nombre entre 0 et " << maxY << " : ";
         cin.clear();
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
     }
@@ -177,14 +208,12 @@ void ConsoleView::update() {
 
 void ConsoleView::run() {
     cout << "=== Jeu de manipulation de pièces ===" << endl;
-    cout << "Grille 8x8 avec plusieurs pièces" << endl;
+    cout << "Grille " << model.getNbColonnes() << "x" << model.getNbLignes() << " avec plusieurs pièces" << endl;
 
     bool continuer = true;
     while (continuer) {
         // Affichage de l'état actuel
-        afficherGrilleNumerotee();
-        afficherPieces();
-        afficherMenu();
+        afficherEcran();
 
         // Traitement du choix utilisateur
         int choix = lireChoix();
@@ -285,17 +314,35 @@ void ConsoleView::run() {
             break;
         }
 
-        case 7: { // Quitter
+        case 7: { // Annulation
+            if (!model.annuler()) {
+                cout << "⚠️ Aucun coup à annuler" << endl;
+            } else {
+                cout << "✅ Coup annulé" << endl;
+            }
+            break;
+        }
+
+        case 8: { // Rétablissement
+            if (!model.retablir()) {
+                cout << "⚠️ Aucun coup à rétablir" << endl;
+            } else {
+                cout << "✅ Coup rétabli" << endl;
+            }
+            break;
+        }
+
+        case 9: { // Quitter
             continuer = false;
             cout << "\nMerci d'avoir joué ! Au revoir." << endl;
             break;
         }
 
         default:
-            cout << "⚠️ Choix invalide. Veuillez choisir entre 1 et 7." << endl;
+            cout << "⚠️ Choix invalide. Veuillez choisir entre 1 et 9." << endl;
         }
         cout << "\nAppuyez sur Entrée pour continuer...";
         cin.get();
-        cout << "\033[2J\033[H";  // Efface l'écran
+        // La frame suivante ne réécrit que les cases modifiées et efface le reste (voir afficherEcran)
     }
 }
\ No newline at end of file
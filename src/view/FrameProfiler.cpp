@@ -0,0 +1,174 @@
+#include "view/FrameProfiler.hpp"
+#include "view/CompteurAllocations.hpp"
+#include "view/Ressources.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    const char* const NOMS_SECTIONS[FrameProfiler::NB_SECTIONS] = {
+        "Evenements", "Modele", "Lots", "Dessin"
+    };
+
+    // Percentile 'p' (0 à 1) de valeurs en microsecondes, en millisecondes
+    double percentileMs(vector<Int64> valeurs, double p) {
+        if (valeurs.empty()) return 0;
+        size_t rang = static_cast<size_t>(p * (valeurs.size() - 1) + 0.5);
+        std::nth_element(valeurs.begin(), valeurs.begin() + rang, valeurs.end());
+        return valeurs[rang] / 1000.0;
+    }
+}
+
+// Mesure implementation
+FrameProfiler::Mesure::Mesure(FrameProfiler& p, Section s) : profiler(p), section(s) {}
+
+FrameProfiler::Mesure::~Mesure() {
+    profiler.courant.sections[section] += horloge.getElapsedTime().asMicroseconds();
+}
+
+// FrameProfiler implementation
+FrameProfiler::FrameProfiler()
+    : suivant(0), nbFrames(0), frameEnCours(false), allocationsDebut(0), toucheEnAttente(false) {
+    echantillons.reserve(CAPACITE);
+    reinitialiserCourant();
+}
+
+unsigned long FrameProfiler::getNbAllocations() {
+    return ::getNbAllocations();
+}
+
+void FrameProfiler::reinitialiserCourant() {
+    courant.duree = 0;
+    for (int s = 0; s < NB_SECTIONS; ++s) {
+        courant.sections[s] = 0;
+    }
+    courant.appelsDessin = 0;
+    courant.allocations = 0;
+    courant.latence = -1;
+}
+
+void FrameProfiler::noteActivite() {
+    if (!frameEnCours) {
+        frameEnCours = true;
+        horlogeFrame.restart();
+        allocationsDebut = getNbAllocations();
+    }
+}
+
+void FrameProfiler::noteTouche() {
+    // Seule la première touche en attente compte : c'est elle qui attend le plus
+    if (!toucheEnAttente) {
+        toucheEnAttente = true;
+        horlogeLatence.restart();
+    }
+}
+
+void FrameProfiler::notePresentation() {
+    noteActivite();
+    courant.duree = horlogeFrame.getElapsedTime().asMicroseconds();
+    courant.allocations = getNbAllocations() - allocationsDebut;
+    if (toucheEnAttente) {
+        courant.latence = horlogeLatence.getElapsedTime().asMicroseconds();
+        toucheEnAttente = false;
+    }
+
+    if (echantillons.size() < CAPACITE) {
+        echantillons.push_back(courant);
+    } else {
+        echantillons[suivant] = courant;
+    }
+    suivant = (suivant + 1) % CAPACITE;
+    ++nbFrames;
+
+    frameEnCours = false;
+    reinitialiserCourant();
+}
+
+void FrameProfiler::abandonnerFrame() {
+    // Sans frame à mesurer, le temps d'attente suivant ne doit pas compter
+    frameEnCours = false;
+    reinitialiserCourant();
+}
+
+vector<FrameProfiler::Echantillon> FrameProfiler::ordonnes() const {
+    if (echantillons.size() < CAPACITE) {
+        return echantillons;
+    }
+    vector<Echantillon> resultat(echantillons.begin() + suivant, echantillons.end());
+    resultat.insert(resultat.end(), echantillons.begin(), echantillons.begin() + suivant);
+    return resultat;
+}
+
+string FrameProfiler::resume() const {
+    ostringstream texte;
+    texte << fixed << setprecision(2);
+    if (echantillons.empty()) {
+        texte << "Aucune frame mesuree";
+        return texte.str();
+    }
+
+    vector<Int64> durees;
+    vector<Int64> latences;
+    Int64 totaux[NB_SECTIONS] = {0, 0, 0, 0};
+    durees.reserve(echantillons.size());
+    for (const Echantillon& e : echantillons) {
+        durees.push_back(e.duree);
+        if (e.latence >= 0) {
+            latences.push_back(e.latence);
+        }
+        for (int s = 0; s < NB_SECTIONS; ++s) {
+            totaux[s] += e.sections[s];
+        }
+    }
+    const Echantillon& dernier = echantillons[(suivant + CAPACITE - 1) % CAPACITE];
+
+    texte << "Frame (ms) p50 " << percentileMs(durees, 0.5) << "  p95 " << percentileMs(durees, 0.95)
+          << "  p99 " << percentileMs(durees, 0.99) << "  max " << percentileMs(durees, 1) << '\n';
+    texte << "Moyennes (ms) :";
+    for (int s = 0; s < NB_SECTIONS; ++s) {
+        texte << ' ' << NOMS_SECTIONS[s] << ' ' << totaux[s] / 1000.0 / echantillons.size();
+    }
+    texte << '\n';
+    texte << "Derniere frame : " << dernier.appelsDessin << " appels de dessin, "
+          << dernier.allocations << " allocations\n";
+    if (latences.empty()) {
+        texte << "Latence touche : aucune mesure\n";
+    } else {
+        texte << "Latence touche (ms) p50 " << percentileMs(latences, 0.5)
+              << "  p95 " << percentileMs(latences, 0.95) << "  (" << latences.size() << " touches)\n";
+    }
+    Int64 dureePolice = Ressources::getDureeChargementPolice();
+    if (dureePolice >= 0) {
+        texte << "Police integree chargee en " << dureePolice / 1000.0 << " ms\n";
+    }
+    texte << nbFrames << " frames, " << echantillons.size() << " conservees | F3 : masquer | F4 : CSV";
+    return texte.str();
+}
+
+void FrameProfiler::exporterCsv(const string& chemin) const {
+    ofstream fichier(chemin.c_str(), ios::trunc);
+    if (!fichier) {
+        throw runtime_error("Impossible de créer le fichier de profil : " + chemin);
+    }
+
+    fichier << "frame,duree_us,evenements_us,modele_us,lots_us,dessin_us,appels_dessin,allocations,latence_us\n";
+    vector<Echantillon> frames = ordonnes();
+    unsigned long numero = nbFrames - frames.size();
+    for (const Echantillon& e : frames) {
+        fichier << numero++ << ',' << e.duree;
+        for (int s = 0; s < NB_SECTIONS; ++s) {
+            fichier << ',' << e.sections[s];
+        }
+        fichier << ',' << e.appelsDessin << ',' << e.allocations << ',';
+        if (e.latence >= 0) {
+            fichier << e.latence;  // Vide si aucune touche n'attendait cette frame
+        }
+        fichier << '\n';
+    }
+
+    if (!fichier) {
+        throw runtime_error("Erreur d'écriture du fichier de profil : " + chemin);
+    }
+}
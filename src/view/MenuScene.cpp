@@ -0,0 +1,256 @@
+#include "view/MenuScene.hpp"
+#include "model/Model.hpp"
+#include "view/Ressources.hpp"
+#include <algorithm>
+
+MenuScene::MenuScene(RenderWindow& w, int n, CacheVignettes* v, function<void(int)> survol)
+    : window(w),
+    vignettes(v),
+    uiView(FloatRect(0, 0, WIDTH, HEIGHT)),
+    nbNiveaux(max(n, 0)),
+    scroll(0),
+    lastMouse(-1, -1),
+    hovered(-1),
+    choice(AUCUN_CHOIX),
+    redrawPending(true),
+    attenteVignettes(false),
+    survolNiveau(survol),
+    survolEnAttente(0) {
+
+    // Police intégrée, chargée une seule fois pour tout le processus
+    const Font& font = Ressources::getPolice();
+
+    // Create title
+    title = Text("Piece Out", font, 48);
+    title.setFillColor(Color::White);
+    title.setPosition(300, 20);
+
+    // Compte des niveaux terminés : quelques mots de 64 bits par millier de niveaux
+    size_t termines = Model::getProgression().compterTermines(nbNiveaux);
+    progressText = Text(to_string(termines) + " / " + to_string(nbNiveaux) + " niveaux terminés", font, 20);
+    progressText.setFillColor(Color(200, 200, 200));
+    progressText.setPosition(MARGE_GAUCHE, 80);
+
+    quitText = Text("Quitter", font, 36);
+    quitText.setFillColor(Color::White);
+    quitText.setPosition(350, HAUT_GRILLE + HAUTEUR_GRILLE + 10);
+
+    // Défilement
+    int nbRangees = (nbNiveaux + COLONNES - 1) / COLONNES;
+    maxScroll = max(0.0f, static_cast<float>(nbRangees * HAUTEUR_CASE - HAUTEUR_GRILLE));
+    gridView.setSize(WIDTH, HAUTEUR_GRILLE);
+    gridView.setViewport(FloatRect(0, static_cast<float>(HAUT_GRILLE) / HEIGHT,
+                                   1, static_cast<float>(HAUTEUR_GRILLE) / HEIGHT));
+    scrollBar.setFillColor(Color(120, 120, 120));
+
+    cellBox.setSize(Vector2f(LARGEUR_CASE - 2 * ESPACE_CASE, HAUTEUR_CASE - 2 * ESPACE_CASE));
+    cellBox.setFillColor(Color(70, 70, 70));
+    cellBox.setOutlineThickness(2);
+
+    // Assez d'étiquettes pour toutes les rangées visibles, même partiellement
+    size_t nbEtiquettes = static_cast<size_t>((HAUTEUR_GRILLE / HAUTEUR_CASE + 2) * COLONNES);
+    labels.assign(nbEtiquettes, Text("", font, 20));
+    labelLevels.assign(nbEtiquettes, 0);
+}
+
+void MenuScene::activate() {
+    window.setSize(Vector2u(WIDTH, HEIGHT));
+    window.setView(uiView);
+    window.setTitle("Piece Out - Menu");
+    redrawPending = true;
+}
+
+void MenuScene::visibleRange(int& first, int& last) const {
+    first = static_cast<int>(scroll) / HAUTEUR_CASE * COLONNES;
+    last = min(nbNiveaux, (static_cast<int>(scroll) + HAUTEUR_GRILLE + HAUTEUR_CASE - 1) / HAUTEUR_CASE * COLONNES);
+}
+
+int MenuScene::optionAt(const Vector2i& pixel) const {
+    Vector2f pos = window.mapPixelToCoords(pixel, uiView);
+    if (quitText.getGlobalBounds().contains(pos)) {
+        return nbNiveaux;
+    }
+
+    // Case de la grille sous la position, par le calcul
+    float x = pos.x - MARGE_GAUCHE;
+    float y = pos.y - HAUT_GRILLE;
+    if (x < 0 || y < 0 || y >= HAUTEUR_GRILLE || x >= COLONNES * LARGEUR_CASE) {
+        return -1;
+    }
+    y += scroll;
+    int colonne = static_cast<int>(x) / LARGEUR_CASE;
+    int rangee = static_cast<int>(y) / HAUTEUR_CASE;
+    float dx = x - colonne * LARGEUR_CASE;
+    float dy = y - rangee * HAUTEUR_CASE;
+    if (dx < ESPACE_CASE || dx >= LARGEUR_CASE - ESPACE_CASE || dy < ESPACE_CASE || dy >= HAUTEUR_CASE - ESPACE_CASE) {
+        return -1;  // Entre deux cases
+    }
+    int index = rangee * COLONNES + colonne;
+    return (index < nbNiveaux) ? index : -1;
+}
+
+void MenuScene::setHovered(int index) {
+    if (index == hovered) {
+        return;
+    }
+    hovered = index;
+    redrawPending = true;
+
+    // Préparer le niveau survolé avant le clic, quand la souris s'y est arrêtée (advance)
+    survolEnAttente = (index >= 0 && index < nbNiveaux && survolNiveau) ? index + 1 : 0;
+    survolClock.restart();
+}
+
+void MenuScene::setScroll(float offset) {
+    offset = max(0.0f, min(maxScroll, offset));
+    if (offset == scroll) {
+        return;
+    }
+    scroll = offset;
+    redrawPending = true;
+
+    // La grille a bougé sous la souris
+    if (lastMouse.x >= 0) {
+        setHovered(optionAt(lastMouse));
+    }
+}
+
+void MenuScene::handleEvent(const Event& event) {
+    switch (event.type) {
+    case Event::MouseMoved:
+        // Highlight option under mouse
+        lastMouse = Vector2i(event.mouseMove.x, event.mouseMove.y);
+        setHovered(optionAt(lastMouse));
+        break;
+
+    case Event::MouseButtonPressed: {
+        if (event.mouseButton.button != Mouse::Left) {
+            break;
+        }
+        int index = optionAt(Vector2i(event.mouseButton.x, event.mouseButton.y));
+        if (index >= 0) {
+            choice = (index < nbNiveaux) ? index + 1 : QUITTER;
+        }
+        break;
+    }
+
+    case Event::MouseWheelScrolled:
+        setScroll(scroll - event.mouseWheelScroll.delta * HAUTEUR_CASE / 2);
+        break;
+
+    case Event::KeyPressed:
+        switch (event.key.code) {
+        case Keyboard::Up: setScroll(scroll - HAUTEUR_CASE); break;
+        case Keyboard::Down: setScroll(scroll + HAUTEUR_CASE); break;
+        case Keyboard::PageUp: setScroll(scroll - HAUTEUR_GRILLE); break;
+        case Keyboard::PageDown: setScroll(scroll + HAUTEUR_GRILLE); break;
+        case Keyboard::Home: setScroll(0); break;
+        case Keyboard::End: setScroll(maxScroll); break;
+        case Keyboard::Escape: choice = QUITTER; break;
+        default: break;
+        }
+        break;
+
+    case Event::Resized:
+    case Event::GainedFocus:
+        redrawPending = true;
+        break;
+
+    default:
+        break;
+    }
+}
+
+void MenuScene::advance() {
+    if (survolEnAttente > 0 && survolClock.getElapsedTime().asMilliseconds() >= DELAI_SURVOL_MS) {
+        survolNiveau(survolEnAttente);
+        survolEnAttente = 0;
+    }
+
+    if (!vignettes) {
+        return;
+    }
+    if (vignettes->integrerRendues()) {
+        redrawPending = true;
+    }
+    attenteVignettes = vignettes->enAttente();
+}
+
+void MenuScene::draw() {
+    window.clear(Color(50, 50, 50));
+    window.setView(uiView);
+    window.draw(title);
+    window.draw(progressText);
+
+    int first, last;
+    visibleRange(first, last);
+    vector<int> manquantes;
+
+    gridView.setCenter(WIDTH / 2.0f, scroll + HAUTEUR_GRILLE / 2.0f);
+    window.setView(gridView);
+    for (int index = first; index < last; ++index) {
+        int level = index + 1;
+        bool termine = Model::isLevelCompleted(level);
+        float x = static_cast<float>(MARGE_GAUCHE + (index % COLONNES) * LARGEUR_CASE + ESPACE_CASE);
+        float y = static_cast<float>((index / COLONNES) * HAUTEUR_CASE + ESPACE_CASE);
+
+        cellBox.setPosition(x, y);
+        cellBox.setOutlineColor(index == hovered ? Color::Yellow : (termine ? Color(50, 200, 50) : Color(100, 100, 100)));
+        window.draw(cellBox);
+
+        // Vignette centrée dans sa zone, réduite si besoin
+        const Texture* texture = vignettes ? vignettes->obtenir(level) : nullptr;
+        if (texture) {
+            Vector2u taille = texture->getSize();
+            float echelle = min(1.0f, min(static_cast<float>(LARGEUR_VIGNETTE) / taille.x,
+                                          static_cast<float>(HAUTEUR_VIGNETTE) / taille.y));
+            thumbnail.setTexture(*texture, true);
+            thumbnail.setScale(echelle, echelle);
+            thumbnail.setPosition(x + (LARGEUR_VIGNETTE - taille.x * echelle) / 2 + ESPACE_CASE,
+                                  y + (HAUTEUR_VIGNETTE - taille.y * echelle) / 2 + ESPACE_CASE);
+            window.draw(thumbnail);
+        } else {
+            manquantes.push_back(level);
+        }
+
+        // Étiquette réécrite seulement quand sa case change de niveau
+        size_t slot = static_cast<size_t>(index) % labels.size();
+        Text& label = labels[slot];
+        if (labelLevels[slot] != level) {
+            label.setString("Niveau " + to_string(level) + (termine ? " *" : ""));
+            label.setPosition(x + 2 * ESPACE_CASE, y + HAUTEUR_VIGNETTE + 2 * ESPACE_CASE);
+            labelLevels[slot] = level;
+        }
+        label.setFillColor(index == hovered ? Color::Yellow : Color::White);
+        window.draw(label);
+    }
+    window.setView(uiView);
+
+    if (maxScroll > 0) {
+        float contenu = maxScroll + HAUTEUR_GRILLE;
+        float hauteur = max(20.0f, HAUTEUR_GRILLE * HAUTEUR_GRILLE / contenu);
+        scrollBar.setSize(Vector2f(6, hauteur));
+        scrollBar.setPosition(WIDTH - 12, HAUT_GRILLE + (HAUTEUR_GRILLE - hauteur) * scroll / maxScroll);
+        window.draw(scrollBar);
+    }
+
+    quitText.setFillColor(hovered == nbNiveaux ? Color::Yellow : Color::White);
+    window.draw(quitText);
+    window.display();
+    redrawPending = false;
+
+    // Vignettes visibles d'abord, puis une rangée de part et d'autre pour le défilement
+    if (vignettes) {
+        for (int index = max(0, first - COLONNES); index < first; ++index) {
+            manquantes.push_back(index + 1);
+        }
+        for (int index = last; index < min(nbNiveaux, last + COLONNES); ++index) {
+            manquantes.push_back(index + 1);
+        }
+        if (manquantes != lastRequest) {
+            vignettes->demander(manquantes);
+            lastRequest = manquantes;
+            attenteVignettes = vignettes->enAttente();
+        }
+    }
+}
@@ -0,0 +1,228 @@
+#include "view/RenduLogiciel.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    // Couleurs de SFMLView
+    const CouleurRGB NOIR = {0, 0, 0};
+    const CouleurRGB PANNEAU = {240, 240, 240};
+    const CouleurRGB LIGNES = {180, 180, 180};
+    const CouleurRGB ZONE = {220, 220, 220};
+    const CouleurRGB ZONE_CONTOUR = {180, 180, 180};
+    const CouleurRGB ARRIVEE = {255, 0, 0};
+    const uint8_t ARRIVEE_ALPHA = 180;
+    const CouleurRGB ARRIVEE_CONTOUR = {200, 0, 0};
+    const CouleurRGB PIECE_A_DEPLACER = {50, 200, 50};
+    const CouleurRGB PIECE = {200, 50, 50};
+    const CouleurRGB PIECE_ACTIVE_CONTOUR = {255, 215, 0};
+
+    const int BORD = 2;               // Contour noir du panneau
+    const int CASE_MIN = 4;
+    const int CONTOURS_MIN = 12;      // Comme SFMLView : pas de contour sous 12 pixels par case
+
+    // Case de la grille : remplissage de tailleCase - 2 pixels, contour à l'extérieur
+    void dessinerCase(ImageRGB& image, int tailleCase, int x, int y,
+                      CouleurRGB remplissage, uint8_t alpha, CouleurRGB contour, int epaisseur) {
+        int px = BORD + x * tailleCase;
+        int py = BORD + y * tailleCase;
+        int taille = tailleCase - 2;
+        int t = epaisseur;
+
+        image.remplirRectangle(px, py, taille, taille, remplissage, alpha);
+        if (tailleCase < CONTOURS_MIN) {
+            return;
+        }
+        image.remplirRectangle(px - t, py - t, taille + 2 * t, t, contour);  // Haut
+        image.remplirRectangle(px - t, py + taille, taille + 2 * t, t, contour);  // Bas
+        image.remplirRectangle(px - t, py, t, taille, contour);  // Gauche
+        image.remplirRectangle(px + taille, py, t, taille, contour);  // Droite
+    }
+
+    // Entiers big-endian du format PNG
+    void ajouterU32(vector<uint8_t>& sortie, uint32_t valeur) {
+        sortie.push_back(static_cast<uint8_t>(valeur >> 24));
+        sortie.push_back(static_cast<uint8_t>(valeur >> 16));
+        sortie.push_back(static_cast<uint8_t>(valeur >> 8));
+        sortie.push_back(static_cast<uint8_t>(valeur));
+    }
+
+    uint32_t crc32(const uint8_t* donnees, size_t taille) {
+        static const vector<uint32_t> table = [] {
+            vector<uint32_t> t(256);
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                t[n] = c;
+            }
+            return t;
+        }();
+
+        uint32_t c = 0xFFFFFFFFu;
+        for (size_t i = 0; i < taille; ++i) {
+            c = table[(c ^ donnees[i]) & 0xFF] ^ (c >> 8);
+        }
+        return c ^ 0xFFFFFFFFu;
+    }
+
+    uint32_t adler32(const vector<uint8_t>& donnees) {
+        uint32_t a = 1, b = 0;
+        for (uint8_t octet : donnees) {
+            a = (a + octet) % 65521;
+            b = (b + a) % 65521;
+        }
+        return (b << 16) | a;
+    }
+
+    // Chunk PNG : longueur, type, données, CRC du type et des données
+    void ajouterChunk(vector<uint8_t>& sortie, const char* type, const vector<uint8_t>& donnees) {
+        ajouterU32(sortie, static_cast<uint32_t>(donnees.size()));
+        size_t debut = sortie.size();
+        sortie.insert(sortie.end(), type, type + 4);
+        sortie.insert(sortie.end(), donnees.begin(), donnees.end());
+        ajouterU32(sortie, crc32(sortie.data() + debut, sortie.size() - debut));
+    }
+
+    void ecrireFichier(const string& chemin, const char* donnees, size_t taille) {
+        ofstream fichier(chemin.c_str(), ios::binary | ios::trunc);
+        if (!fichier) {
+            throw runtime_error("Impossible de créer l'image : " + chemin);
+        }
+        fichier.write(donnees, taille);
+        if (!fichier) {
+            throw runtime_error("Erreur d'écriture de l'image : " + chemin);
+        }
+    }
+}
+
+// ImageRGB implementation
+ImageRGB::ImageRGB(int l, int h, CouleurRGB fond) : largeur(l), hauteur(h), pixels(l * h * 3) {
+    remplirRectangle(0, 0, largeur, hauteur, fond);
+}
+
+void ImageRGB::remplirRectangle(int x, int y, int l, int h, CouleurRGB couleur, uint8_t alpha) {
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + l, largeur);
+    int y1 = std::min(y + h, hauteur);
+
+    for (int py = y0; py < y1; ++py) {
+        uint8_t* pixel = &pixels[(py * largeur + x0) * 3];
+        for (int px = x0; px < x1; ++px, pixel += 3) {
+            if (alpha == 255) {
+                pixel[0] = couleur.r;
+                pixel[1] = couleur.g;
+                pixel[2] = couleur.b;
+            } else {
+                pixel[0] = static_cast<uint8_t>((couleur.r * alpha + pixel[0] * (255 - alpha)) / 255);
+                pixel[1] = static_cast<uint8_t>((couleur.g * alpha + pixel[1] * (255 - alpha)) / 255);
+                pixel[2] = static_cast<uint8_t>((couleur.b * alpha + pixel[2] * (255 - alpha)) / 255);
+            }
+        }
+    }
+}
+
+void ImageRGB::ecrirePPM(const string& chemin) const {
+    string contenu = "P6\n" + to_string(largeur) + " " + to_string(hauteur) + "\n255\n";
+    contenu.append(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+    ecrireFichier(chemin, contenu.data(), contenu.size());
+}
+
+void ImageRGB::ecrirePNG(const string& chemin) const {
+    static const uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    vector<uint8_t> png(SIGNATURE, SIGNATURE + 8);
+
+    // En-tête : RGB 8 bits, sans entrelacement
+    vector<uint8_t> entete;
+    ajouterU32(entete, static_cast<uint32_t>(largeur));
+    ajouterU32(entete, static_cast<uint32_t>(hauteur));
+    const uint8_t suite[5] = {8, 2, 0, 0, 0};
+    entete.insert(entete.end(), suite, suite + 5);
+    ajouterChunk(png, "IHDR", entete);
+
+    // Rangées précédées de leur filtre (0 : aucun)
+    size_t ligne = static_cast<size_t>(largeur) * 3;
+    vector<uint8_t> brut;
+    brut.reserve((ligne + 1) * hauteur);
+    for (int y = 0; y < hauteur; ++y) {
+        brut.push_back(0);
+        brut.insert(brut.end(), pixels.begin() + y * ligne, pixels.begin() + (y + 1) * ligne);
+    }
+
+    // Flux zlib fait de blocs deflate stockés (65535 octets au plus chacun)
+    vector<uint8_t> zlib = {0x78, 0x01};
+    size_t position = 0;
+    do {
+        size_t taille = std::min<size_t>(65535, brut.size() - position);
+        bool dernier = (position + taille == brut.size());
+        zlib.push_back(dernier ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(taille & 0xFF));
+        zlib.push_back(static_cast<uint8_t>(taille >> 8));
+        zlib.push_back(static_cast<uint8_t>(~taille & 0xFF));
+        zlib.push_back(static_cast<uint8_t>((~taille >> 8) & 0xFF));
+        zlib.insert(zlib.end(), brut.begin() + position, brut.begin() + position + taille);
+        position += taille;
+    } while (position < brut.size());
+    ajouterU32(zlib, adler32(brut));
+    ajouterChunk(png, "IDAT", zlib);
+
+    ajouterChunk(png, "IEND", vector<uint8_t>());
+    ecrireFichier(chemin, reinterpret_cast<const char*>(png.data()), png.size());
+}
+
+// Rendu des niveaux
+ImageRGB rendreNiveau(const Niveau& niveau, int tailleCase, size_t pieceActive) {
+    if (tailleCase < CASE_MIN) {
+        throw invalid_argument("Taille de case trop petite : " + to_string(tailleCase));
+    }
+
+    int largeur = niveau.largeur;
+    int hauteur = niveau.hauteur;
+    ImageRGB image(largeur * tailleCase + 2 * BORD, hauteur * tailleCase + 2 * BORD, NOIR);
+
+    // Panneau et lignes de la grille
+    image.remplirRectangle(BORD, BORD, largeur * tailleCase, hauteur * tailleCase, PANNEAU);
+    for (int x = 0; x <= largeur; ++x) {
+        image.remplirRectangle(BORD + x * tailleCase, BORD, 1, hauteur * tailleCase, LIGNES);
+    }
+    for (int y = 0; y <= hauteur; ++y) {
+        image.remplirRectangle(BORD, BORD + y * tailleCase, largeur * tailleCase, 1, LIGNES);
+    }
+
+    // Zones autorisées, puis zones d'arrivée par-dessus
+    for (int y = 0; y < hauteur; ++y) {
+        for (int x = 0; x < largeur; ++x) {
+            if (niveau.zonesAutorisees[y * largeur + x]) {
+                dessinerCase(image, tailleCase, x, y, ZONE, 255, ZONE_CONTOUR, 1);
+            }
+        }
+    }
+    for (int y = 0; y < hauteur; ++y) {
+        for (int x = 0; x < largeur; ++x) {
+            if (niveau.zonesArrivee[y * largeur + x]) {
+                dessinerCase(image, tailleCase, x, y, ARRIVEE, ARRIVEE_ALPHA, ARRIVEE_CONTOUR, 2);
+            }
+        }
+    }
+
+    // Pièces posées
+    for (size_t i = 0; i < niveau.pieces.size(); ++i) {
+        if (!niveau.posees[i]) continue;
+        const pair<int, int>& position = niveau.positions[i];
+
+        CouleurRGB remplissage = (i == niveau.pieceADeplacer) ? PIECE_A_DEPLACER : PIECE;
+        bool active = (i == pieceActive);
+        for (const pair<int, int>& coord : niveau.pieces[i]) {
+            dessinerCase(image, tailleCase, position.first + coord.first, position.second + coord.second,
+                         remplissage, 255, active ? PIECE_ACTIVE_CONTOUR : NOIR, active ? 3 : 1);
+        }
+    }
+
+    return image;
+}
+
+ImageRGB rendreModele(const Model& model, int tailleCase) {
+    return rendreNiveau(model.extraireNiveau(), tailleCase, model.getPieceActiveIndex());
+}
@@ -0,0 +1,35 @@
+#include "view/Ressources.hpp"
+#include <atomic>
+#include <stdexcept>
+
+using namespace std;
+
+// Police générée par "xxd -i arial.ttf" (voir la règle du Makefile)
+extern unsigned char arial_ttf[];
+extern unsigned int arial_ttf_len;
+
+namespace {
+    atomic<Int64> dureeChargementPolice(-1);  // Microsecondes, -1 tant que la police n'est pas chargée
+
+    Font chargerPolice() {
+        Clock chrono;
+        Font police;
+        // Le tampon doit rester valide tant que la police est utilisée : il est statique
+        if (!police.loadFromMemory(arial_ttf, arial_ttf_len)) {
+            throw runtime_error("Impossible de charger la police intégrée");
+        }
+        dureeChargementPolice = chrono.getElapsedTime().asMicroseconds();
+        return police;
+    }
+}
+
+const Font& Ressources::getPolice() {
+    // Initialisée une seule fois au premier appel, même depuis plusieurs threads,
+    // puis partagée jusqu'à la fin du processus
+    static const Font police = chargerPolice();
+    return police;
+}
+
+Int64 Ressources::getDureeChargementPolice() {
+    return dureeChargementPolice;
+}
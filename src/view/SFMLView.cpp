@@ -1,27 +1,56 @@
 #include "view/SFMLView.hpp"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
-SFMLView::SFMLView(Model& m)
+SFMLView::SFMLView(Model& m, RenderWindow& w)
     : model(m),
-    gridLines(Lines, (model.getNbColonnes() + 1 + model.getNbLignes() + 1) * 2),
+    window(w),
+    windowTitle("Piece Out - Niveau Puzzle"),
+    font(Ressources::getPolice()),
+    batchCameraRevision(0),
+    boardOutlines(true),
+    isPanning(false),
+    gridLines(Lines),
+    backgroundAvailable(false),
+    backgroundDirty(true),
+    boardZonesRevision(0),
+    displayedActivePiece(static_cast<size_t>(-1)),
+    textRebuildCount(0),
+    boardBatch(Quads),
+    pieceBatch(Quads),
+    dragBatch(Quads),
+    batchesDirty(true),
+    batchActivePiece(0),
+    dragCell(-1, -1),
+    dragValid(false),
+    redrawPending(true),
+    profilerVisible(false),
+    wasAnimating(false),
+    pendingPathPiece(0),
+    victoryFade(0),
+    dragMovePending(false),
     selectedCell(-1, -1),
     isDragging(false),
     draggedPieceIndex(0),
     dragOffset(0, 0),
     victoryDisplayed(false),
-    returnToMenu(false) {
+    returnToMenu(false),
+    finished(false) {
 
     // Initialiser les dimensions selon le modèle
-    VISIBLE_ROWS = model.getNbLignes();
-    VISIBLE_COLS = model.getNbColonnes();
+    VISIBLE_ROWS = std::min(model.getNbLignes(), static_cast<int>(MAX_VISIBLE_ROWS));
+    VISIBLE_COLS = std::min(model.getNbColonnes(), static_cast<int>(MAX_VISIBLE_COLS));
     NB_COL = model.getNbColonnes();
     NB_LIGNE = model.getNbLignes();
 
     model.addObserver(this);
-    initWindow();
-    loadFonts();
+    for (size_t i = 0; i < model.getNbPieces(); ++i) {
+        shownPositions.push_back(model.getPosition(i));
+    }
     initGrid();
     initButtons();
+    initHudTexts();
     loadTextures();
 }
 
@@ -29,51 +58,49 @@ SFMLView::~SFMLView() {
     // Se retirer de la liste des observateurs du modèle avant la destruction
     model.removeObserver(this);
 
-    // Nettoyer les ressources SFML
-    window.close();
+    // La fenêtre appartient au SceneManager : elle reste ouverte pour la scène suivante
 
     // Vider les vecteurs et libérer la mémoire
-    pieceShapes.clear();
     buttons.clear();
     buttonLabels.clear();
     textures.clear();
     gridLines.clear();
 
     // Libérer l'excès de mémoire pour les vecteurs
-    pieceShapes.shrink_to_fit();
     buttons.shrink_to_fit();
     buttonLabels.shrink_to_fit();
 }
 
-void SFMLView::loadFonts() {
-    // Essayer d'abord notre police locale, puis les polices système en secours
-    const vector<string> fontPaths = {
-        "resources/arial.ttf",  // Police locale
-        "/System/Library/Fonts/Helvetica.ttc",  // Police système macOS
-        "/Library/Fonts/Arial.ttf",  // Autre emplacement possible sur macOS
-        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",  // Polices Linux en dernier recours
-        "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
-        "/usr/share/fonts/truetype/ubuntu/Ubuntu-R.ttf"
-    };
-
-    bool fontLoaded = false;
-    for (const string& path : fontPaths) {
-        if (font.loadFromFile(path)) {
-            fontLoaded = true;
-            break;
-        }
+void SFMLView::initWindow() {
+    // Adapter la fenêtre existante au niveau, sans recréer de contexte
+    unsigned int width = MARGIN_LEFT + MARGIN_RIGHT + VISIBLE_COLS * TILE_SIZE + BUTTON_WIDTH + BUTTON_SPACING;
+    unsigned int height = MARGIN_TOP + MARGIN_BOTTOM + VISIBLE_ROWS * TILE_SIZE;
+    window.setSize(Vector2u(width, height));
+    uiView = View(FloatRect(0, 0, width, height));
+    window.setView(uiView);
+    window.setTitle(windowTitle);
+
+    // La caméra montre le panneau de la grille ; sur un grand plateau, elle suit la pièce à déplacer
+    camera.setup(FloatRect(gridPane.getPosition(), gridPane.getSize()), Vector2f(width, height),
+                 Vector2f(NB_COL * TILE_SIZE, NB_LIGNE * TILE_SIZE));
+    if (model.getNbPieces() > 0) {
+        ensurePieceVisible(model.getPieceADeplacer());
     }
+}
 
-    if (!fontLoaded) {
-        throw runtime_error("Impossible de charger une police");
-    }
+void SFMLView::setWindowTitle(const string& title) {
+    windowTitle = title;
+    window.setTitle(windowTitle);
 }
 
-void SFMLView::initWindow() {
-    unsigned int width = MARGIN_LEFT + MARGIN_RIGHT + VISIBLE_COLS * TILE_SIZE + BUTTON_WIDTH + BUTTON_SPACING;
-    unsigned int height = MARGIN_TOP + MARGIN_BOTTOM + VISIBLE_ROWS * TILE_SIZE;
-    window.create(VideoMode(width, height), "Piece Out - Niveau Puzzle");
-    window.setFramerateLimit(60);
+void SFMLView::activate() {
+    initWindow();
+
+    // La vue a changé de taille : décor et textes centrés à refaire
+    centerText(victoryText);
+    victoryOverlay.setSize(window.getView().getSize());
+    backgroundDirty = true;
+    redrawPending = true;
 }
 
 void SFMLView::initButtons() {
@@ -87,7 +114,7 @@ void SFMLView::initButtons() {
         "Menu Principal"
     };
 
-    float buttonX = MARGIN_LEFT + NB_COL * TILE_SIZE + BUTTON_SPACING;
+    float buttonX = MARGIN_LEFT + VISIBLE_COLS * TILE_SIZE + BUTTON_SPACING;
     float buttonY = MARGIN_TOP;
 
     for (const string& name : buttonNames) {
@@ -114,6 +141,37 @@ void SFMLView::initButtons() {
     }
 }
 
+void SFMLView::initHudTexts() {
+    // Afficher les contrôles sur trois lignes
+    controlsText1 = Text("R: Rotation horaire | E: Rotation anti-horaire | S: Symetrie verticale", font, 16);
+    controlsText2 = Text("H: Sym. horizontale | Z/Y: Annuler/Retablir | Tab: Piece suiv. | M: Menu | Esc: Quitter", font, 16);
+    controlsText3 = Text("Molette, PgUp/PgDn: Zoom | Clic droit: Deplacer la vue | Origine: Recentrer", font, 16);
+    controlsText1.setPosition(MARGIN_LEFT, MARGIN_TOP + VISIBLE_ROWS * TILE_SIZE + 10);
+    controlsText2.setPosition(MARGIN_LEFT, MARGIN_TOP + VISIBLE_ROWS * TILE_SIZE + 30);
+    controlsText3.setPosition(MARGIN_LEFT, MARGIN_TOP + VISIBLE_ROWS * TILE_SIZE + 50);
+    controlsText1.setFillColor(Color::Black);
+    controlsText2.setFillColor(Color::Black);
+    controlsText3.setFillColor(Color::Black);
+
+    // Le contenu est fixé au premier affichage
+    activePieceText.setFont(font);
+    activePieceText.setCharacterSize(16);
+    activePieceText.setPosition(MARGIN_LEFT + VISIBLE_COLS * TILE_SIZE + BUTTON_WIDTH + BUTTON_SPACING * 2, MARGIN_TOP);
+    activePieceText.setFillColor(Color::Black);
+
+    profilerText.setFont(font);
+    profilerText.setCharacterSize(12);
+    profilerText.setFillColor(Color::White);
+    profilerText.setPosition(10, 8);
+    profilerPanel.setPosition(5, 5);
+    profilerPanel.setFillColor(Color(0, 0, 0, 200));
+
+    createVictoryText(victoryText);
+    victoryOverlay.setFillColor(Color(0, 0, 0, 180));  // Plus opaque pour meilleure lisibilité
+
+    textRebuildCount += 5;
+}
+
 void SFMLView::initGridPane() {
     // Initialiser le panneau central
     gridPane.setSize(Vector2f(VISIBLE_COLS * TILE_SIZE, VISIBLE_ROWS * TILE_SIZE));
@@ -123,41 +181,11 @@ void SFMLView::initGridPane() {
     gridPane.setOutlineColor(Color::Black);
 }
 
-void SFMLView::initHorizontalLines(int& lineIndex) {
-    // Lignes horizontales
-    for (int i = 0; i <= VISIBLE_ROWS; ++i) {
-        gridLines[lineIndex].position = Vector2f(MARGIN_LEFT, MARGIN_TOP + i * TILE_SIZE);
-        gridLines[lineIndex].color = Color(180, 180, 180);  // Gris moyen
-        lineIndex++;
-        gridLines[lineIndex].position = Vector2f(MARGIN_LEFT + VISIBLE_COLS * TILE_SIZE, MARGIN_TOP + i * TILE_SIZE);
-        gridLines[lineIndex].color = Color(180, 180, 180);
-        lineIndex++;
-    }
-}
-
-void SFMLView::initVerticalLines(int& lineIndex) {
-    // Lignes verticales
-    for (int i = 0; i <= VISIBLE_COLS; ++i) {
-        gridLines[lineIndex].position = Vector2f(MARGIN_LEFT + i * TILE_SIZE, MARGIN_TOP);
-        gridLines[lineIndex].color = Color(180, 180, 180);
-        lineIndex++;
-        gridLines[lineIndex].position = Vector2f(MARGIN_LEFT + i * TILE_SIZE, MARGIN_TOP + VISIBLE_ROWS * TILE_SIZE);
-        gridLines[lineIndex].color = Color(180, 180, 180);
-        lineIndex++;
-    }
-}
-
 void SFMLView::initGrid() {
     // Initialiser le panneau central
     initGridPane();
 
-    // Initialiser les lignes de la grille
-    gridLines.resize((VISIBLE_COLS + 1 + VISIBLE_ROWS + 1) * 2);
-    int lineIndex = 0;
-
-    // Initialiser les lignes horizontales et verticales
-    initHorizontalLines(lineIndex);
-    initVerticalLines(lineIndex);
+    // Les lignes de la grille ne couvrent que les cases visibles (voir rebuildGridLines)
 }
 
 void SFMLView::loadTextures() {
@@ -165,97 +193,189 @@ void SFMLView::loadTextures() {
 }
 
 void SFMLView::handleVictoryCondition() {
-    if (model.isPartieGagnee() && !victoryDisplayed) {
-        // Dessiner une dernière frame pour montrer la position finale
+    // Attendre que la pièce ait fini de glisser pour montrer la position finale
+    if (model.isPartieGagnee() && !victoryDisplayed && slides.empty()) {
+        victoryDisplayed = true;
+
+        // Position finale 200 ms, fondu du message 300 ms, message seul 500 ms
+        timeline.start("victoire", 0.3f,
+            [this](float t) { setVictoryFade(t); },
+            [this]() {
+                timeline.start("victoire-affichage", 0.5f, Timeline::Etape(), [this]() { finished = true; });
+            },
+            0.2f);
+    }
+}
+
+void SFMLView::setVictoryFade(float fade) {
+    victoryFade = fade;
+    victoryOverlay.setFillColor(Color(0, 0, 0, static_cast<Uint8>(180 * fade)));
+    victoryText.setFillColor(Color(0, 255, 0, static_cast<Uint8>(255 * fade)));
+    victoryText.setOutlineColor(Color(0, 0, 0, static_cast<Uint8>(255 * fade)));
+}
+
+void SFMLView::drawFrame() {
+    // Les lots sont reconstruits avant de chronométrer la soumission du dessin
+    updateBatches();
+    {
+        FrameProfiler::Mesure mesure(profiler, FrameProfiler::DESSIN);
         window.clear(Color::White);
         drawGrid();
         drawPieces();
         drawUI();
-        window.display();
+        if (victoryFade > 0) {
+            drawVictoryMessage();
+        }
+        if (profilerVisible) {
+            drawProfiler();
+        }
+    }
+    window.display();
+    profiler.notePresentation();
+}
 
-        // Attendre un court instant pour montrer la position finale
-        sleep(milliseconds(200));
+void SFMLView::drawProfiler() {
+    // Recalculer les percentiles à chaque frame fausserait la mesure
+    if (profilerRefresh.getElapsedTime() > milliseconds(250) || profilerText.getString().isEmpty()) {
+        profilerText.setString(profiler.resume());
+        FloatRect bounds = profilerText.getLocalBounds();
+        profilerPanel.setSize(Vector2f(bounds.width + 15, bounds.height + 15));
+        profilerRefresh.restart();
+        ++textRebuildCount;
+    }
+    submit(profilerPanel);
+    submit(profilerText);
+}
 
-        // Afficher le message de victoire
-        drawVictoryMessage();
-        window.display();
+void SFMLView::exportProfile() {
+    const string chemin = "profil_frames.csv";
+    try {
+        profiler.exporterCsv(chemin);
+        cout << "Profil des frames exporté : " << chemin << endl;
+    }
+    catch (const runtime_error& e) {
+        cerr << "Erreur : " << e.what() << endl;
+    }
+}
 
-        // Afficher brièvement le message de victoire
-        sleep(milliseconds(800));
+void SFMLView::submit(const Drawable& drawable, const RenderStates& states) {
+    window.draw(drawable, states);
+    profiler.noteAppelDessin();
+}
 
-        victoryDisplayed = true;
-        window.close();
-    }
+void SFMLView::submit(RenderTarget& target, const Drawable& drawable) {
+    target.draw(drawable);
+    profiler.noteAppelDessin();
 }
 
-void SFMLView::drawFrame() {
-    window.clear(Color::White);
-    drawGrid();
-    drawPieces();
-    drawUI();
-    window.display();
+void SFMLView::draw() {
+    drawFrame();
+    redrawPending = false;
 }
 
-void SFMLView::run() {
-    while (window.isOpen()) {
-        // Gérer tous les événements en attente
-        handleEvents();
+void SFMLView::advance() {
+    profiler.noteActivite();
 
-        // Vérifier la condition de victoire
-        handleVictoryCondition();
+    // Tous les événements de la frame sont arrivés : appliquer les entrées regroupées
+    applyPendingInput();
 
-        // Dessiner la frame courante
-        if (window.isOpen()) {  // Vérifier à nouveau car handleVictoryCondition peut fermer la fenêtre
-            drawFrame();
-        }
+    // Vérifier la condition de victoire
+    handleVictoryCondition();
+
+    // Le temps passé à attendre un événement ne compte pas pour une animation qui démarre
+    float dt = frameClock.restart().asSeconds();
+    timeline.advance(wasAnimating ? dt : 0);
+    wasAnimating = timeline.isRunning();
+
+    // Aucune frame ne suivra : le SceneManager va dormir jusqu'au prochain événement
+    if (!needsRedraw()) {
+        profiler.abandonnerFrame();
     }
 }
 
-void SFMLView::handleEvents() {
-    Event event;
-    while (window.pollEvent(event)) {
-        switch (event.type) {
-        case Event::Closed:
-            window.close();
-            break;
+void SFMLView::printStats() const {
+    cout << "Textes mis en page : " << textRebuildCount << " (5 à l'ouverture, puis un par changement de pièce active)" << endl;
+}
 
-        case Event::KeyPressed:
-            handleKeyPress(event.key.code);
-            break;
+void SFMLView::handleEvent(const Event& event) {
+    profiler.noteActivite();
+    FrameProfiler::Mesure mesure(profiler, FrameProfiler::EVENEMENTS);
+    if (event.type == Event::KeyPressed) {
+        profiler.noteTouche();
+    }
 
-        case Event::MouseButtonPressed:
-            if (event.mouseButton.button == Mouse::Left) {
-                handleMouseClick(Vector2i(event.mouseButton.x, event.mouseButton.y));
-            }
-            break;
+    // Pendant l'animation de victoire, seules les touches de sortie sont prises en compte
+    if (victoryDisplayed) {
+        if (event.type == Event::KeyPressed &&
+            (event.key.code == Keyboard::Escape || event.key.code == Keyboard::M)) {
+            handleNavigationKeys(event.key.code);
+        }
+        return;
+    }
 
-        case Event::MouseButtonReleased:
-            if (event.mouseButton.button == Mouse::Left) {
-                handleMouseRelease(Vector2i(event.mouseButton.x, event.mouseButton.y));
-            }
-            break;
+    // Les entrées regroupées précèdent tout autre événement qui pourrait modifier le modèle
+    bool arrowKey = event.type == Event::KeyPressed &&
+        (event.key.code == Keyboard::Up || event.key.code == Keyboard::Down ||
+         event.key.code == Keyboard::Left || event.key.code == Keyboard::Right);
+    if (!arrowKey && event.type != Event::MouseMoved) {
+        applyPendingInput();
+    }
 
-        case Event::MouseMoved:
-            handleMouseMove(Vector2i(event.mouseMove.x, event.mouseMove.y));
-            break;
+    handleCameraEvent(event);
 
-        default:
-            break;
+    switch (event.type) {
+    case Event::KeyPressed:
+        handleKeyPress(event.key.code);
+        redrawPending = true;  // La pièce active peut changer sans notification du modèle
+        break;
+
+    case Event::MouseButtonPressed:
+        if (event.mouseButton.button == Mouse::Left) {
+            handleMouseClick(Vector2i(event.mouseButton.x, event.mouseButton.y));
+            redrawPending = true;
         }
+        break;
+
+    case Event::MouseButtonReleased:
+        if (event.mouseButton.button == Mouse::Left) {
+            handleMouseRelease(Vector2i(event.mouseButton.x, event.mouseButton.y));
+            redrawPending = true;
+        }
+        break;
+
+    case Event::MouseMoved:
+        // Ne redessine que si le fantôme change de case (voir rebuildDragBatch)
+        handleMouseMove(Vector2i(event.mouseMove.x, event.mouseMove.y));
+        break;
+
+    case Event::GainedFocus:
+        redrawPending = true;
+        break;
+
+    default:
+        break;
     }
 }
 
 void SFMLView::handleNavigationKeys(Keyboard::Key key) {
     switch (key) {
     case Keyboard::Escape:
-        window.close();
+        finished = true;
         break;
 
     case Keyboard::M:  // Retour au menu
-        window.close();
+        finished = true;
         returnToMenu = true;
         break;
 
+    case Keyboard::F3:  // Profil des frames
+        profilerVisible = !profilerVisible;
+        break;
+
+    case Keyboard::F4:  // Export du profil
+        exportProfile();
+        break;
+
     case Keyboard::Tab:  // Changer de pièce active
         if (model.getNbPieces() > 0) {
             size_t nextPiece = (model.getPieceActiveIndex() + 1) % model.getNbPieces();
@@ -270,6 +390,7 @@ void SFMLView::handleNavigationKeys(Keyboard::Key key) {
 }
 
 void SFMLView::handleTransformationKeys(Keyboard::Key key) {
+    FrameProfiler::Mesure mesure(profiler, FrameProfiler::MODELE);
     switch (key) {
     case Keyboard::R:  // Rotation horaire
         model.rotationPiece(OrientationRotation::HORAIRE);
@@ -287,6 +408,14 @@ void SFMLView::handleTransformationKeys(Keyboard::Key key) {
         model.symetriePiece(OrientationSymetrie::HORIZONTALE);
         break;
 
+    case Keyboard::Z:  // Annuler le dernier coup (avec ou sans Ctrl)
+        model.annuler();
+        break;
+
+    case Keyboard::Y:  // Rétablir le coup annulé
+        model.retablir();
+        break;
+
     default:
         // Ignorer les autres touches
         break;
@@ -314,48 +443,34 @@ void SFMLView::handleKeyPress(Keyboard::Key key) {
 }
 
 void SFMLView::handlePieceMovement(Keyboard::Key key) {
-    // Récupérer la pièce active
-    size_t activePiece = model.getPieceActiveIndex();
-    if (!model.isPiecePosee(activePiece)) {
-        return;  // Si la pièce n'est pas placée, ignorer le mouvement
-    }
-
-    pair<int, int> pos = model.getPosition(activePiece);
-    pair<int, int> newPos = pos;
-
-    // Calculer la nouvelle position selon la touche
+    // Les répétitions d'une touche maintenue s'accumulent jusqu'à la frame suivante
     switch (key) {
-    case Keyboard::Up:    newPos.second--; break;
-    case Keyboard::Down:  newPos.second++; break;
-    case Keyboard::Left:  newPos.first--;  break;
-    case Keyboard::Right: newPos.first++;  break;
+    case Keyboard::Up:    pendingSteps.push_back(OrientationDeplacement::NORD);  break;
+    case Keyboard::Down:  pendingSteps.push_back(OrientationDeplacement::SUD);   break;
+    case Keyboard::Left:  pendingSteps.push_back(OrientationDeplacement::OUEST); break;
+    case Keyboard::Right: pendingSteps.push_back(OrientationDeplacement::EST);   break;
     default: return;  // Ne devrait jamais arriver grâce au switch du caller
     }
+}
 
-    // Vérifier si la nouvelle position est dans les limites de la grille
-    const vector<pair<int, int>>& coords = model.getPieceCoords(activePiece);
-    bool validMove = true;
-
-    for (const pair<int, int>& coord : coords) {
-        int x = newPos.first + coord.first;
-        int y = newPos.second + coord.second;
-
-        // Vérifier les limites de la grille
-        if (x < 0 || x >= model.getNbColonnes() || y < 0 || y >= model.getNbLignes()) {
-            validMove = false;
-            break;
-        }
+void SFMLView::applyPendingInput() {
+    if (!pendingSteps.empty()) {
+        FrameProfiler::Mesure mesure(profiler, FrameProfiler::MODELE);
 
-        // Vérifier si la nouvelle position est dans une zone autorisée
-        if (!model.estZoneAutorisee(x, y)) {
-            validMove = false;
-            break;
+        // Un seul déplacement, validé pas à pas par le modèle
+        size_t activePiece = model.getPieceActiveIndex();
+        if (model.translaterPiece(pendingSteps)) {
+            ensurePieceVisible(activePiece);
         }
+        pendingSteps.clear();
     }
 
-    // Si le mouvement est valide, mettre à jour la position de la pièce
-    if (validMove) {
-        model.placerPiece(newPos.first, newPos.second);
+    // Seule la dernière position de la souris compte pour le fantôme
+    if (dragMovePending) {
+        dragMovePending = false;
+        if (isDragging) {
+            updateDraggedPiece(pendingDragPos);
+        }
     }
 }
 
@@ -373,7 +488,7 @@ bool SFMLView::handleButtonClicks(const Vector2i& mousePos) {
 bool SFMLView::isPieceAtPosition(size_t pieceIndex, const Vector2i& gridPos) {
     if (!model.isPiecePosee(pieceIndex)) return false;
 
-    const vector<pair<int, int>>& coords = model.getPieceCoords(pieceIndex);
+    const Coordonnees& coords = model.getPieceCoords(pieceIndex);
     const pair<int, int>& piecePos = model.getPosition(pieceIndex);
 
     for (const pair<int, int>& coord : coords) {
@@ -408,26 +523,31 @@ void SFMLView::handleMouseClick(const Vector2i& mousePos) {
     if (handleButtonClicks(mousePos)) return;
 
     Vector2i gridPos = windowToGrid(mousePos);
-    if (isInsideGrid(gridPos) && !isDragging) {
+    if (isInsidePane(mousePos) && isInsideGrid(gridPos) && !isDragging) {
         handlePieceSelection(gridPos, mousePos);
     }
 }
 
 void SFMLView::handleMouseMove(const Vector2i& mousePos) {
     if (isDragging) {
-        updateDraggedPiece(mousePos);
+        pendingDragPos = mousePos;
+        dragMovePending = true;
     }
 }
 
 void SFMLView::handleMouseRelease(const Vector2i& mousePos) {
+    FrameProfiler::Mesure mesure(profiler, FrameProfiler::MODELE);
     if (isDragging) {
         Vector2i gridPos = windowToGrid(mousePos);
-        if (isInsideGrid(gridPos)) {
+        if (isInsidePane(mousePos) && isInsideGrid(gridPos)) {
             if (draggedPieceIndex == model.getPieceADeplacer()) {
                 pair<int, int> currentPos = model.getPosition(draggedPieceIndex);
                 pair<int, int> newPos = make_pair(gridPos.x, gridPos.y);
 
-                if (isValidMove(newPos) && isPathClear(currentPos, newPos)) {
+                if (isValidMove(newPos)) {
+                    // La pièce glissera le long du chemin trouvé par le modèle
+                    pendingPath = model.getChemin(newPos);
+                    pendingPathPiece = draggedPieceIndex;
                     model.placerPiece(newPos.first, newPos.second);
                 } else {
                     model.placerPiece(currentPos.first, currentPos.second);
@@ -441,6 +561,7 @@ void SFMLView::handleMouseRelease(const Vector2i& mousePos) {
 }
 
 void SFMLView::handleButtonClick(int buttonIndex) {
+    FrameProfiler::Mesure mesure(profiler, FrameProfiler::MODELE);
     switch (buttonIndex) {
     case 0:  // Rotation horaire
         model.rotationPiece(OrientationRotation::HORAIRE);
@@ -465,128 +586,302 @@ void SFMLView::handleButtonClick(int buttonIndex) {
         victoryDisplayed = false;
         break;
     case 6:  // Return to menu
-        window.close();
+        finished = true;
         returnToMenu = true;
         break;
     }
 }
 
 void SFMLView::drawGrid() {
+    updateBatches();
+
+    // Le décor statique est plaqué en une seule image
+    if (backgroundAvailable) {
+        submit(backgroundSprite);
+    } else {
+        drawStaticLayer(window);
+    }
+
+    // Lignes et zones visibles, vues par la caméra
+    window.setView(camera.getView());
+    submit(gridLines);
+    submit(boardBatch);
+    window.setView(uiView);
+}
+
+void SFMLView::drawStaticLayer(RenderTarget& target) {
     // Dessiner le panneau de la grille
-    window.draw(gridPane);
+    submit(target, gridPane);
+
+    // Dessiner les boutons dans leur état actif
+    for (size_t i = 0; i < buttons.size(); ++i) {
+        drawButton(target, i, true);
+    }
+}
 
-    // Dessiner les lignes de la grille
-    window.draw(gridLines);
+void SFMLView::rebuildBackground() {
+    // Même taille que la vue pour que le sprite se superpose pixel pour pixel
+    Vector2u size(static_cast<unsigned int>(uiView.getSize().x),
+                  static_cast<unsigned int>(uiView.getSize().y));
+    if (background.getSize() != size) {
+        backgroundAvailable = background.create(size.x, size.y);
+    }
+    if (!backgroundAvailable) {
+        return;  // Pas de rendu hors écran : drawGrid dessine directement
+    }
+
+    background.clear(Color::White);
+    drawStaticLayer(background);
+    background.display();
+    backgroundSprite.setTexture(background.getTexture(), true);
+}
 
-    // Dessiner les zones autorisées
+void SFMLView::drawPieces() {
+    updateBatches();
+
+    // Dessiner les pièces posées, celles qui glissent, puis le fantôme de la pièce déplacée
+    window.setView(camera.getView());
+    submit(pieceBatch);
+    for (const pair<const size_t, PieceSlide>& slide : slides) {
+        RenderStates states;
+        states.transform.translate(slide.second.offset);
+        submit(slide.second.cells, states);
+    }
+    if (isDragging) {
+        submit(dragBatch);
+    }
+    window.setView(uiView);
+}
+
+void SFMLView::appendQuad(VertexArray& batch, float left, float top, float width, float height, const Color& color) {
+    batch.append(Vertex(Vector2f(left, top), color));
+    batch.append(Vertex(Vector2f(left + width, top), color));
+    batch.append(Vertex(Vector2f(left + width, top + height), color));
+    batch.append(Vertex(Vector2f(left, top + height), color));
+}
+
+void SFMLView::appendCell(VertexArray& batch, const Vector2i& gridPos, const Color& fillColor, const Color& outlineColor, float outlineThickness) {
+    // Même rendu qu'un RectangleShape : contour à l'extérieur du remplissage
+    Vector2f pos = gridToWorld(gridPos);
+    float size = TILE_SIZE - 2;
+    float t = outlineThickness;
+
+    appendQuad(batch, pos.x, pos.y, size, size, fillColor);
+    if (!boardOutlines) {
+        return;  // Zoom trop faible pour que les contours soient visibles
+    }
+    appendQuad(batch, pos.x - t, pos.y - t, size + 2 * t, t, outlineColor);  // Haut
+    appendQuad(batch, pos.x - t, pos.y + size, size + 2 * t, t, outlineColor);  // Bas
+    appendQuad(batch, pos.x - t, pos.y, t, size, outlineColor);  // Gauche
+    appendQuad(batch, pos.x + size, pos.y, t, size, outlineColor);  // Droite
+}
+
+void SFMLView::updateBatches() {
+    FrameProfiler::Mesure mesure(profiler, FrameProfiler::LOTS);
+
+    // Le décor ne change qu'avec la taille de la fenêtre
+    if (backgroundDirty) {
+        rebuildBackground();
+        backgroundDirty = false;
+    }
+
+    // Un déplacement de la caméra ne reconstruit que si d'autres cases deviennent visibles
+    bool cameraMoved = false;
+    if (batchCameraRevision != camera.getRevision()) {
+        cameraMoved = updateVisibleCells();
+        batchCameraRevision = camera.getRevision();
+    }
+
+    // Le plateau ne change qu'avec les zones du niveau ou la zone visible
+    if (cameraMoved || boardZonesRevision != model.getRevisionZones()) {
+        rebuildGridLines();
+        rebuildBoardBatch();
+        boardZonesRevision = model.getRevisionZones();
+    }
+
+    // La pièce active change sans notification du modèle
+    if (cameraMoved || batchesDirty || batchActivePiece != model.getPieceActiveIndex()) {
+        rebuildPieceBatch();
+        updateButtonStates();
+        batchActivePiece = model.getPieceActiveIndex();
+        batchesDirty = false;
+    }
+}
+
+void SFMLView::rebuildBoardBatch() {
+    // clear() conserve la capacité : pas d'allocation une fois la taille atteinte
+    boardBatch.clear();
+
+    // Les sets sont triés par x puis y : chaque colonne visible est une plage du set
     const set<pair<int, int>>& zones = model.getZonesAutorisees();
-    for (const pair<int, int>& zone : zones) {
-        Vector2i pathPos(zone.first, zone.second);
-        if (isVisibleInGrid(pathPos)) {
-            RectangleShape pathCell(Vector2f(TILE_SIZE - 2, TILE_SIZE - 2));
-            pathCell.setPosition(gridToWindow(pathPos));
-            pathCell.setFillColor(Color(220, 220, 220));  // Gris clair
-            pathCell.setOutlineThickness(1);
-            pathCell.setOutlineColor(Color(180, 180, 180));
-            window.draw(pathCell);
+    const set<pair<int, int>>& zonesArrivee = model.getZonesArrivee();
+    int xMax = visibleCells.left + visibleCells.width;
+    int yMax = visibleCells.top + visibleCells.height;
+
+    // Zones autorisées
+    for (int x = visibleCells.left; x < xMax; ++x) {
+        set<pair<int, int>>::const_iterator it = zones.lower_bound(make_pair(x, visibleCells.top));
+        for (; it != zones.end() && it->first == x && it->second < yMax; ++it) {
+            appendCell(boardBatch, Vector2i(it->first, it->second), Color(220, 220, 220), Color(180, 180, 180), 1);  // Gris clair
         }
     }
 
-    // Dessiner toutes les zones d'arrivée
-    const set<pair<int, int>>& zonesArrivee = model.getZonesArrivee();
-    for (const pair<int, int>& zone : zonesArrivee) {
-        Vector2i zonePos(zone.first, zone.second);
-        if (isVisibleInGrid(zonePos)) {
-            RectangleShape targetCell(Vector2f(TILE_SIZE - 2, TILE_SIZE - 2));
-            targetCell.setPosition(gridToWindow(zonePos));
-            targetCell.setFillColor(Color(255, 0, 0, 180));  // Rouge plus vif et plus opaque
-            targetCell.setOutlineThickness(2);
-            targetCell.setOutlineColor(Color(200, 0, 0));    // Contour rouge foncé
-            window.draw(targetCell);
+    // Zones d'arrivée, par-dessus les zones autorisées
+    for (int x = visibleCells.left; x < xMax; ++x) {
+        set<pair<int, int>>::const_iterator it = zonesArrivee.lower_bound(make_pair(x, visibleCells.top));
+        for (; it != zonesArrivee.end() && it->first == x && it->second < yMax; ++it) {
+            appendCell(boardBatch, Vector2i(it->first, it->second), Color(255, 0, 0, 180), Color(200, 0, 0), 2);  // Rouge vif, contour rouge foncé
         }
     }
 }
 
-void SFMLView::drawPieces() {
-    // Mettre à jour les formes des pièces
-    updatePieceShapes();
+void SFMLView::rebuildGridLines() {
+    gridLines.clear();
+    if (camera.getZoom() * TILE_SIZE < MIN_LINE_PIXELS) {
+        return;  // Lignes trop serrées pour être utiles
+    }
+
+    Color lineColor(180, 180, 180);  // Gris moyen
+    float left = visibleCells.left * TILE_SIZE;
+    float top = visibleCells.top * TILE_SIZE;
+    float right = (visibleCells.left + visibleCells.width) * TILE_SIZE;
+    float bottom = (visibleCells.top + visibleCells.height) * TILE_SIZE;
 
-    // Dessiner toutes les pièces
-    for (const RectangleShape& shape : pieceShapes) {
-        window.draw(shape);
+    // Lignes horizontales
+    for (int y = visibleCells.top; y <= visibleCells.top + visibleCells.height; ++y) {
+        gridLines.append(Vertex(Vector2f(left, y * TILE_SIZE), lineColor));
+        gridLines.append(Vertex(Vector2f(right, y * TILE_SIZE), lineColor));
     }
-}
 
-void SFMLView::initPieceShapes() {
-    // Pré-allouer un nombre raisonnable de formes
-    pieceShapes.reserve(model.getNbPieces() * 4);  // 4 cases max par pièce
+    // Lignes verticales
+    for (int x = visibleCells.left; x <= visibleCells.left + visibleCells.width; ++x) {
+        gridLines.append(Vertex(Vector2f(x * TILE_SIZE, top), lineColor));
+        gridLines.append(Vertex(Vector2f(x * TILE_SIZE, bottom), lineColor));
+    }
 }
 
-void SFMLView::createPieceShape(const Vector2i& gridPos, const Color& fillColor, const Color& outlineColor, int outlineThickness) {
-    RectangleShape shape(Vector2f(TILE_SIZE - 2, TILE_SIZE - 2));
-    shape.setPosition(gridToWindow(gridPos));
-    shape.setFillColor(fillColor);
-    shape.setOutlineThickness(outlineThickness);
-    shape.setOutlineColor(outlineColor);
-    pieceShapes.push_back(shape);
+bool SFMLView::updateVisibleCells() {
+    // Cases qui intersectent la zone vue par la caméra, bornées au plateau
+    FloatRect area = camera.getVisibleArea();
+    int x0 = std::max(0, static_cast<int>(std::floor(area.left / TILE_SIZE)));
+    int y0 = std::max(0, static_cast<int>(std::floor(area.top / TILE_SIZE)));
+    int x1 = std::min(NB_COL, static_cast<int>(std::ceil((area.left + area.width) / TILE_SIZE)));
+    int y1 = std::min(NB_LIGNE, static_cast<int>(std::ceil((area.top + area.height) / TILE_SIZE)));
+    IntRect cells(x0, y0, std::max(0, x1 - x0), std::max(0, y1 - y0));
+    bool outlines = camera.getZoom() * TILE_SIZE >= MIN_OUTLINE_PIXELS;
+
+    bool changed = cells.left != visibleCells.left || cells.top != visibleCells.top
+                || cells.width != visibleCells.width || cells.height != visibleCells.height
+                || outlines != boardOutlines;
+    visibleCells = cells;
+    boardOutlines = outlines;
+    return changed;
 }
 
-void SFMLView::updateStaticPieces() {
+void SFMLView::rebuildPieceBatch() {
+    pieceBatch.clear();
+    for (pair<const size_t, PieceSlide>& slide : slides) {
+        slide.second.cells.clear();
+    }
+
     for (size_t i = 0; i < model.getNbPieces(); ++i) {
-        if (model.isPiecePosee(i) && (!isDragging || i != draggedPieceIndex)) {
-            const vector<pair<int, int>>& coords = model.getPieceCoords(i);
-            pair<int, int> pos = model.getPosition(i);
+        // La pièce déplacée à la souris n'est dessinée que par son fantôme
+        if (!model.isPiecePosee(i) || (isDragging && i == draggedPieceIndex)) continue;
 
-            for (const pair<int, int>& coord : coords) {
-                Vector2i gridPos(pos.first + coord.first, pos.second + coord.second);
-                if (isVisibleInGrid(gridPos)) {
-                    Color fillColor = (i == model.getPieceADeplacer()) ?
-                        Color(50, 200, 50) :  // Vert pour la pièce à déplacer
-                        Color(200, 50, 50);   // Rouge pour les autres pièces
+        const Coordonnees& coords = model.getPieceCoords(i);
+        pair<int, int> pos = model.getPosition(i);
 
-                    Color outlineColor = (i == model.getPieceActiveIndex()) ?
-                        Color(255, 215, 0) :  // Bordure dorée
-                        Color::Black;
+        Color fillColor = (i == model.getPieceADeplacer()) ?
+            Color(50, 200, 50) :  // Vert pour la pièce à déplacer
+            Color(200, 50, 50);   // Rouge pour les autres pièces
 
-                    int outlineThickness = (i == model.getPieceActiveIndex()) ? 3 : 1;
+        bool active = (i == model.getPieceActiveIndex());
+        Color outlineColor = active ? Color(255, 215, 0) : Color::Black;  // Bordure dorée
+        float outlineThickness = active ? 3 : 1;
 
-                    createPieceShape(gridPos, fillColor, outlineColor, outlineThickness);
-                }
+        // Une pièce qui glisse a son propre lot, décalé à chaque frame
+        map<size_t, PieceSlide>::iterator slide = slides.find(i);
+        VertexArray& batch = (slide != slides.end()) ? slide->second.cells : pieceBatch;
+
+        for (const pair<int, int>& coord : coords) {
+            Vector2i gridPos(pos.first + coord.first, pos.second + coord.second);
+            if (isVisibleInGrid(gridPos)) {
+                appendCell(batch, gridPos, fillColor, outlineColor, outlineThickness);
             }
         }
     }
 }
 
-void SFMLView::updateDraggedPiece() {
-    if (!isDragging) return;
+void SFMLView::rebuildDragBatch(const Vector2i& mousePos) {
+    // Le fantôme annonce si le lâcher serait accepté (mêmes règles que handleMouseRelease),
+    // sans jouer le coup
+    Vector2i dropPos = windowToGrid(mousePos);
+    bool valid;
+    if (draggedPieceIndex == model.getPieceADeplacer()) {
+        valid = isValidMove(make_pair(dropPos.x, dropPos.y));
+    } else {
+        valid = model.apercuPlacement(draggedPieceIndex, dropPos.x, dropPos.y).valide;
+    }
+
+    // Ne reconstruire que si le fantôme change de case ou de couleur
+    Vector2i gridPos = windowToGrid(mousePos - Vector2i(dragOffset));
+    if (gridPos == dragCell && valid == dragValid && dragBatch.getVertexCount() > 0) {
+        return;
+    }
+    dragCell = gridPos;
+    dragValid = valid;
+    dragBatch.clear();
+    redrawPending = true;
 
-    const vector<pair<int, int>>& coords = model.getPieceCoords(draggedPieceIndex);
-    Vector2i gridPos = windowToGrid(Mouse::getPosition(window) - Vector2i(dragOffset));
+    Color fillColor = valid ?
+        Color(50, 200, 50, 128) :  // Vert transparent
+        Color(200, 50, 50, 128);   // Rouge transparent
 
+    const Coordonnees& coords = model.getPieceCoords(draggedPieceIndex);
     for (const pair<int, int>& coord : coords) {
         Vector2i piecePos(gridPos.x + coord.first, gridPos.y + coord.second);
         if (isVisibleInGrid(piecePos)) {
-            Color fillColor = (draggedPieceIndex == model.getPieceADeplacer()) ?
-                Color(50, 200, 50, 128) :  // Vert transparent
-                Color(200, 50, 50, 128);   // Rouge transparent
-
-            createPieceShape(piecePos, fillColor, Color(255, 215, 0, 128), 3);
+            appendCell(dragBatch, piecePos, fillColor, Color(255, 215, 0, 128), 3);
         }
     }
 }
 
-void SFMLView::updatePieceShapes() {
-    pieceShapes.clear();  // Vider le vecteur
-    pieceShapes.reserve(model.getNbPieces() * 4);  // Réserver l'espace nécessaire
-    updateStaticPieces();
-    updateDraggedPiece();
-    pieceShapes.shrink_to_fit();  // Libérer l'excès de mémoire
+void SFMLView::updateButtonStates() {
+    FrameProfiler::Mesure mesure(profiler, FrameProfiler::MODELE);
+
+    // Les boutons de transformation ne sont actifs que si le coup est légal
+    vector<bool> actifs(buttons.size(), true);
+    size_t active = model.getPieceActiveIndex();
+    const bool legaux[] = {
+        model.apercuRotation(active, OrientationRotation::HORAIRE).valide,
+        model.apercuRotation(active, OrientationRotation::ANTIHORAIRE).valide,
+        model.apercuSymetrie(active, OrientationSymetrie::HORIZONTALE).valide,
+        model.apercuSymetrie(active, OrientationSymetrie::VERTICALE).valide
+    };
+    for (size_t i = 0; i < 4 && i < actifs.size(); ++i) {
+        actifs[i] = legaux[i];
+    }
+
+    buttonEnabled.swap(actifs);
+}
+
+void SFMLView::drawButton(RenderTarget& target, size_t index, bool enabled) {
+    buttons[index].setFillColor(enabled ? Color(200, 200, 200) : Color(170, 170, 170));
+    buttonLabels[index].setFillColor(enabled ? Color::Black : Color(120, 120, 120));
+    submit(target, buttons[index]);
+    submit(target, buttonLabels[index]);
 }
 
 void SFMLView::drawButtons() {
+    updateBatches();
+
+    // Les boutons actifs sont dans le décor : seuls les boutons grisés sont redessinés
     for (size_t i = 0; i < buttons.size(); ++i) {
-        window.draw(buttons[i]);
-        window.draw(buttonLabels[i]);
+        if (!buttonEnabled[i]) {
+            drawButton(window, i, false);
+        } else if (!backgroundAvailable) {
+            drawButton(window, i, true);
+        }
     }
 }
 
@@ -594,25 +889,19 @@ void SFMLView::drawActivePieceInfo() {
     size_t activePiece = model.getPieceActiveIndex();
     if (activePiece >= model.getNbPieces()) return;
 
-    Text infoText("Piece active: " + to_string(activePiece), font, 16);
-    infoText.setPosition(MARGIN_LEFT + NB_COL * TILE_SIZE + BUTTON_WIDTH + BUTTON_SPACING * 2, MARGIN_TOP);
-    infoText.setFillColor(Color::Black);
-    window.draw(infoText);
+    // Ne refaire la mise en page que lorsque la pièce active change
+    if (activePiece != displayedActivePiece) {
+        activePieceText.setString("Piece active: " + to_string(activePiece));
+        displayedActivePiece = activePiece;
+        ++textRebuildCount;
+    }
+    submit(activePieceText);
 }
 
 void SFMLView::drawControlsInfo() {
-    // Afficher les contrôles sur deux lignes
-    Text controls1("R: Rotation horaire | E: Rotation anti-horaire | S: Symetrie verticale", font, 16);
-    Text controls2("H: Symetrie horizontale | Tab: Piece suivante | M: Menu | Esc: Quitter", font, 16);
-
-    controls1.setPosition(MARGIN_LEFT, MARGIN_TOP + NB_LIGNE * TILE_SIZE + 10);
-    controls2.setPosition(MARGIN_LEFT, MARGIN_TOP + NB_LIGNE * TILE_SIZE + 30);
-
-    controls1.setFillColor(Color::Black);
-    controls2.setFillColor(Color::Black);
-
-    window.draw(controls1);
-    window.draw(controls2);
+    submit(controlsText1);
+    submit(controlsText2);
+    submit(controlsText3);
 }
 
 void SFMLView::drawUI() {
@@ -628,58 +917,50 @@ void SFMLView::drawUI() {
 
 void SFMLView::drawVictoryOverlay() {
     // Fond semi-transparent noir
-    RectangleShape overlay(Vector2f(window.getSize().x, window.getSize().y));
-    overlay.setFillColor(Color(0, 0, 0, 180));  // Plus opaque pour meilleure lisibilité
-    window.draw(overlay);
+    submit(victoryOverlay);
 }
 
-void SFMLView::createVictoryText(Text& victoryText) {
+void SFMLView::createVictoryText(Text& text) {
     // Message de victoire principal
-    victoryText.setString("NIVEAU COMPLETE !");
-    victoryText.setFont(font);
-    victoryText.setCharacterSize(48);
-    victoryText.setStyle(Text::Bold);
-    victoryText.setFillColor(Color::Green);
-    victoryText.setOutlineThickness(3);
-    victoryText.setOutlineColor(Color::Black);
+    text.setString("NIVEAU COMPLETE !");
+    text.setFont(font);
+    text.setCharacterSize(48);
+    text.setStyle(Text::Bold);
+    text.setFillColor(Color::Green);
+    text.setOutlineThickness(3);
+    text.setOutlineColor(Color::Black);
 }
 
 void SFMLView::centerText(Text& text) {
     // Centrer le message
     FloatRect textBounds = text.getLocalBounds();
     text.setPosition(
-        (window.getSize().x - textBounds.width) / 2,
-        (window.getSize().y - textBounds.height) / 2
+        (window.getView().getSize().x - textBounds.width) / 2,
+        (window.getView().getSize().y - textBounds.height) / 2
     );
 }
 
 void SFMLView::drawVictoryMessage() {
     drawVictoryOverlay();
-
-    Text victoryText;
-    createVictoryText(victoryText);
-    centerText(victoryText);
-    window.draw(victoryText);
+    submit(victoryText);
 }
 
 Vector2i SFMLView::windowToGrid(const Vector2i& windowPos) const {
-    // Ajuster la position pour centrer la vue sur la partie visible
-    int offsetX = (NB_COL - VISIBLE_COLS) / 2;
-    int offsetY = (NB_LIGNE - VISIBLE_ROWS) / 2;
+    // Passer par la caméra : pixel de la fenêtre -> coordonnées du plateau
+    Vector2f world = window.mapPixelToCoords(windowPos, camera.getView());
     return Vector2i(
-        (windowPos.x - MARGIN_LEFT) / TILE_SIZE + offsetX,
-        (windowPos.y - MARGIN_TOP) / TILE_SIZE + offsetY
+        static_cast<int>(std::floor(world.x / TILE_SIZE)),
+        static_cast<int>(std::floor(world.y / TILE_SIZE))
     );
 }
 
 Vector2f SFMLView::gridToWindow(const Vector2i& gridPos) const {
-    // Ajuster la position pour centrer la vue sur la partie visible
-    int offsetX = (NB_COL - VISIBLE_COLS) / 2;
-    int offsetY = (NB_LIGNE - VISIBLE_ROWS) / 2;
-    return Vector2f(
-        MARGIN_LEFT + (gridPos.x - offsetX) * TILE_SIZE,
-        MARGIN_TOP + (gridPos.y - offsetY) * TILE_SIZE
-    );
+    return Vector2f(window.mapCoordsToPixel(gridToWorld(gridPos), camera.getView()));
+}
+
+Vector2f SFMLView::gridToWorld(const Vector2i& gridPos) const {
+    // Coordonnées du plateau, dessiné dans la View de la caméra
+    return Vector2f(gridPos.x * TILE_SIZE, gridPos.y * TILE_SIZE);
 }
 
 bool SFMLView::isInsideGrid(const Vector2i& pos) const {
@@ -687,12 +968,14 @@ bool SFMLView::isInsideGrid(const Vector2i& pos) const {
     return pos.x >= 0 && pos.x < NB_COL && pos.y >= 0 && pos.y < NB_LIGNE;
 }
 
+bool SFMLView::isInsidePane(const Vector2i& windowPos) const {
+    // Hors du panneau, la caméra ne montre rien : pas de case sous la souris
+    return FloatRect(gridPane.getPosition(), gridPane.getSize()).contains(Vector2f(windowPos));
+}
+
 bool SFMLView::isVisibleInGrid(const Vector2i& pos) const {
     // Vérifier si la position est dans la partie visible de la grille
-    int offsetX = (NB_COL - VISIBLE_COLS) / 2;
-    int offsetY = (NB_LIGNE - VISIBLE_ROWS) / 2;
-    return pos.x >= offsetX && pos.x < offsetX + VISIBLE_COLS &&
-        pos.y >= offsetY && pos.y < offsetY + VISIBLE_ROWS;
+    return visibleCells.contains(pos);
 }
 
 bool SFMLView::isInsideButton(const Vector2i& pos, int buttonIndex) const {
@@ -711,90 +994,186 @@ void SFMLView::startDragging(size_t pieceIndex, const Vector2i& mousePos) {
     pair<int, int> piecePos = model.getPosition(pieceIndex);
     Vector2f windowPos = gridToWindow(Vector2i(piecePos.first, piecePos.second));
     dragOffset = Vector2f(mousePos - Vector2i(windowPos));
+
+    // La pièce quitte le lot des pièces posées au profit de son fantôme
+    batchesDirty = true;
+    dragBatch.clear();
+    rebuildDragBatch(mousePos);
 }
 
 void SFMLView::stopDragging() {
     isDragging = false;
+    dragMovePending = false;
+    batchesDirty = true;
 }
 
 void SFMLView::updateDraggedPiece(const Vector2i& mousePos) {
-    // La mise à jour visuelle est gérée dans drawPieces()
+    rebuildDragBatch(mousePos);
 }
 
-void SFMLView::update() {
-    // La mise à jour sera faite à la prochaine frame
-}
-
-bool SFMLView::isPositionOccupied(int x, int y) {
-    // Vérifier si une pièce (autre que celle à déplacer) occupe la position
-    for (size_t i = 0; i < model.getNbPieces(); ++i) {
-        if (i != model.getPieceADeplacer() && model.isPiecePosee(i)) {
-            const vector<pair<int, int>>& coords = model.getPieceCoords(i);
-            pair<int, int> pos = model.getPosition(i);
-            for (const pair<int, int>& coord : coords) {
-                if (pos.first + coord.first == x &&
-                    pos.second + coord.second == y) {
-                    return true;  // Position occupée
-                }
+void SFMLView::handleCameraEvent(const Event& event) {
+    unsigned long revision = camera.getRevision();
+
+    switch (event.type) {
+    case Event::MouseWheelScrolled:
+        // Le point sous le curseur reste sous le curseur
+        if (event.mouseWheelScroll.wheel == Mouse::VerticalWheel) {
+            Vector2i mousePos(event.mouseWheelScroll.x, event.mouseWheelScroll.y);
+            if (isInsidePane(mousePos)) {
+                camera.zoomAt(std::pow(1.1f, event.mouseWheelScroll.delta),
+                              window.mapPixelToCoords(mousePos, camera.getView()));
             }
         }
-    }
-    return false;
-}
+        break;
 
-bool SFMLView::isVerticalPathClear(const pair<int, int>& start, const pair<int, int>& end) {
-    int step = (end.second > start.second) ? 1 : -1;
-    for (int y = start.second + step; (step > 0) ? (y <= end.second) : (y >= end.second); y += step) {
-        if (isPositionOccupied(start.first, y)) {
-            return false;  // Chemin bloqué
+    case Event::MouseButtonPressed:
+        if (event.mouseButton.button == Mouse::Right) {
+            isPanning = true;
+            panLast = Vector2i(event.mouseButton.x, event.mouseButton.y);
         }
-    }
-    return true;
-}
+        break;
+
+    case Event::MouseButtonReleased:
+        if (event.mouseButton.button == Mouse::Right) {
+            isPanning = false;
+        }
+        break;
 
-bool SFMLView::isHorizontalPathClear(const pair<int, int>& start, const pair<int, int>& end) {
-    int step = (end.first > start.first) ? 1 : -1;
-    for (int x = start.first + step; (step > 0) ? (x <= end.first) : (x >= end.first); x += step) {
-        if (isPositionOccupied(x, start.second)) {
-            return false;  // Chemin bloqué
+    case Event::MouseMoved:
+        if (isPanning) {
+            Vector2i mousePos(event.mouseMove.x, event.mouseMove.y);
+            camera.pan(Vector2f(mousePos - panLast));
+            panLast = mousePos;
         }
+        break;
+
+    case Event::KeyPressed:
+        switch (event.key.code) {
+        case Keyboard::PageUp:
+        case Keyboard::Add:
+            camera.zoomAt(1.25f, camera.getView().getCenter());
+            break;
+        case Keyboard::PageDown:
+        case Keyboard::Subtract:
+            camera.zoomAt(0.8f, camera.getView().getCenter());
+            break;
+        case Keyboard::Home:
+            camera.reset();
+            break;
+        default:
+            break;
+        }
+        break;
+
+    case Event::Resized:
+        // La View garde sa taille logique : seul le décor est recomposé
+        backgroundDirty = true;
+        redrawPending = true;
+        break;
+
+    default:
+        break;
+    }
+
+    if (camera.getRevision() != revision) {
+        redrawPending = true;
     }
-    return true;
 }
 
-bool SFMLView::isPathClear(const pair<int, int>& start, const pair<int, int>& end) {
-    // Pour un déplacement vertical
-    if (start.first == end.first) {
-        return isVerticalPathClear(start, end);
+void SFMLView::ensurePieceVisible(size_t pieceIndex) {
+    // Recentrer seulement si la pièce sort de la zone visible
+    pair<int, int> position = model.getPosition(pieceIndex);
+    if (position.first == -1) {
+        return;
     }
-    // Pour un déplacement horizontal
-    else if (start.second == end.second) {
-        return isHorizontalPathClear(start, end);
+    Vector2i anchor(position.first, position.second);
+    FloatRect area = camera.getVisibleArea();
+    Vector2f world = gridToWorld(anchor);
+    if (!area.contains(world) || !area.contains(world + Vector2f(TILE_SIZE, TILE_SIZE))) {
+        camera.centerOn(world + Vector2f(TILE_SIZE / 2.0f, TILE_SIZE / 2.0f));
     }
-    // Pour un déplacement diagonal ou autre, on autorise si les deux cases sont libres
-    else {
-        return isPathClear(start, make_pair(start.first, end.second)) &&
-            isPathClear(make_pair(start.first, end.second), end);
+}
+
+void SFMLView::update() {
+    // Les lots seront reconstruits à la prochaine frame, qui doit être dessinée
+    batchesDirty = true;
+    redrawPending = true;
+    detectMovedPieces();
+}
+
+void SFMLView::detectMovedPieces() {
+    for (size_t i = 0; i < model.getNbPieces() && i < shownPositions.size(); ++i) {
+        pair<int, int> position = model.getPosition(i);
+        if (position == shownPositions[i]) continue;
+
+        // Une pièce qui vient d'être posée ou retirée apparaît sans glisser
+        if (position.first != -1 && shownPositions[i].first != -1) {
+            bool knownPath = (i == pendingPathPiece && pendingPath.size() > 1
+                              && pendingPath.front() == shownPositions[i] && pendingPath.back() == position);
+            vector<pair<int, int>> gridPath;
+            if (knownPath) {
+                gridPath = pendingPath;
+            } else {
+                gridPath.push_back(shownPositions[i]);
+                gridPath.push_back(position);
+            }
+            startSlide(i, gridPath);
+        }
+        shownPositions[i] = position;
     }
-    return true;
+    pendingPath.clear();
 }
 
-bool SFMLView::isValidMove(const pair<int, int>& newPos) {
-    const vector<pair<int, int>>& coords = model.getPieceCoords(model.getPieceADeplacer());
+void SFMLView::startSlide(size_t pieceIndex, const vector<pair<int, int>>& gridPath) {
+    Vector2f arrival = gridToWorld(Vector2i(gridPath.back().first, gridPath.back().second));
 
-    for (const pair<int, int>& coord : coords) {
-        int x = newPos.first + coord.first;
-        int y = newPos.second + coord.second;
+    // Repartir de la position affichée si la pièce glissait déjà
+    vector<Vector2f> path;
+    map<size_t, PieceSlide>::iterator current = slides.find(pieceIndex);
+    Vector2f start = gridToWorld(Vector2i(gridPath.front().first, gridPath.front().second));
+    if (current != slides.end()) {
+        start = gridToWorld(Vector2i(shownPositions[pieceIndex].first, shownPositions[pieceIndex].second))
+              + current->second.offset;
+    }
+    path.push_back(start - arrival);
+    for (size_t k = 1; k < gridPath.size(); ++k) {
+        path.push_back(gridToWorld(Vector2i(gridPath[k].first, gridPath[k].second)) - arrival);
+    }
 
-        if (x < 0 || x >= model.getNbColonnes() || y < 0 || y >= model.getNbLignes()) {
-            return false;
-        }
+    PieceSlide& slide = slides[pieceIndex];
+    slide.cells.setPrimitiveType(Quads);
+    slide.path.swap(path);
+    slide.offset = slide.path.front();
+
+    // 80 ms par case, 400 ms au plus
+    float duration = std::min(0.4f, 0.08f * (slide.path.size() - 1));
+    timeline.start("glissement" + to_string(pieceIndex), duration,
+        [this, pieceIndex](float t) {
+            map<size_t, PieceSlide>::iterator it = slides.find(pieceIndex);
+            if (it != slides.end()) {
+                it->second.offset = pointOnPath(it->second.path, Timeline::easeInOut(t));
+            }
+        },
+        [this, pieceIndex]() {
+            slides.erase(pieceIndex);
+            batchesDirty = true;  // La pièce rejoint le lot des pièces posées
+            redrawPending = true;
+        });
+    batchesDirty = true;
+}
 
-        if (!model.estZoneAutorisee(x, y)) {
-            return false;
-        }
+Vector2f SFMLView::pointOnPath(const vector<Vector2f>& path, float t) {
+    size_t segments = path.size() - 1;
+    if (segments == 0) {
+        return path.front();
     }
+    float f = t * segments;
+    size_t k = std::min(static_cast<size_t>(f), segments - 1);
+    float local = f - k;
+    return path[k] + (path[k + 1] - path[k]) * local;
+}
 
-    pair<int, int> currentPos = model.getPosition(model.getPieceADeplacer());
-    return isPathClear(currentPos, newPos);
+bool SFMLView::isValidMove(const pair<int, int>& newPos) {
+    // Le modèle connaît toutes les positions atteignables par des déplacements légaux
+    return model.estPositionAtteignable(newPos);
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "view/SceneManager.hpp"
+#include <ctime>
+#include <iostream>
+
+using namespace std;
+
+SceneManager::SceneManager(RenderWindow& w)
+    : window(w), frameCount(0), eventCount(0), idleTime(Time::Zero) {
+    window.setFramerateLimit(60);  // Plafond pendant les glisser-déposer
+}
+
+void SceneManager::run(Scene& scene) {
+    frameCount = 0;
+    eventCount = 0;
+    idleTime = Time::Zero;
+    std::clock_t cpuStart = std::clock();
+    Clock sceneClock;
+
+    scene.activate();
+
+    while (window.isOpen() && !scene.isFinished()) {
+        // Rien à redessiner : dormir jusqu'au prochain événement
+        if (!scene.needsRedraw()) {
+            Clock waitClock;
+            Event event;
+            if (window.waitEvent(event)) {
+                idleTime += waitClock.getElapsedTime();
+                dispatch(scene, event);
+            }
+        }
+
+        // Gérer tous les événements en attente
+        Event event;
+        while (window.isOpen() && window.pollEvent(event)) {
+            dispatch(scene, event);
+        }
+
+        scene.advance();
+
+        // Dessiner la frame seulement si quelque chose a changé
+        if (window.isOpen() && !scene.isFinished() && scene.needsRedraw()) {
+            scene.draw();
+            ++frameCount;
+        }
+    }
+
+    printStats(scene, sceneClock.getElapsedTime().asSeconds(),
+               static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC);
+}
+
+void SceneManager::dispatch(Scene& scene, const Event& event) {
+    ++eventCount;
+
+    // Fermer la fenêtre unique quitte le jeu, quelle que soit la scène
+    if (event.type == Event::Closed) {
+        window.close();
+        return;
+    }
+    scene.handleEvent(event);
+}
+
+void SceneManager::printStats(const Scene& scene, double seconds, double cpuSeconds) const {
+    if (seconds <= 0) return;
+
+    cout << "Rendu : " << frameCount << " frames, " << eventCount << " événements en "
+         << seconds << " s" << endl;
+    cout << "Inactif " << 100.0 * idleTime.asSeconds() / seconds << " % du temps, CPU "
+         << 100.0 * cpuSeconds / seconds << " % d'un coeur" << endl;
+    scene.printStats();
+}
@@ -0,0 +1,139 @@
+#include "view/ScriptConsole.hpp"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    [[noreturn]] void erreur(unsigned long numero, const string& message) {
+        throw runtime_error("Commande " + to_string(numero) + " : " + message);
+    }
+}
+
+ScriptConsole::ScriptConsole(Model& m) : model(m) {}
+
+bool ScriptConsole::executerCommande(char commande, istream& entree, unsigned long numero) {
+    switch (commande) {
+    case 'p': {  // Placement
+        int x, y;
+        if (!(entree >> x >> y)) {
+            erreur(numero, "coordonnées attendues après 'p'");
+        }
+        return model.placerPiece(x, y);
+    }
+
+    case 'd': {  // Déplacement
+        char direction = '\0';
+        entree >> direction;
+        switch (direction) {
+        case 'N': return model.deplacerPiece(OrientationDeplacement::NORD);
+        case 'S': return model.deplacerPiece(OrientationDeplacement::SUD);
+        case 'E': return model.deplacerPiece(OrientationDeplacement::EST);
+        case 'O': return model.deplacerPiece(OrientationDeplacement::OUEST);
+        default: erreur(numero, "direction attendue après 'd' : N, S, E ou O");
+        }
+    }
+
+    case 'r': {  // Rotation
+        char sens = '\0';
+        entree >> sens;
+        switch (sens) {
+        case 'H': return model.rotationPiece(OrientationRotation::HORAIRE);
+        case 'A': return model.rotationPiece(OrientationRotation::ANTIHORAIRE);
+        default: erreur(numero, "sens attendu après 'r' : H ou A");
+        }
+    }
+
+    case 's': {  // Symétrie
+        char sens = '\0';
+        entree >> sens;
+        switch (sens) {
+        case 'H': return model.symetriePiece(OrientationSymetrie::HORIZONTALE);
+        case 'V': return model.symetriePiece(OrientationSymetrie::VERTICALE);
+        default: erreur(numero, "sens attendu après 's' : H ou V");
+        }
+    }
+
+    case 'c': {  // Choix de la pièce active
+        long index;
+        if (!(entree >> index)) {
+            erreur(numero, "numéro de pièce attendu après 'c'");
+        }
+        // Une pièce inconnue ou déjà active ne change rien et n'est pas journalisée
+        if (index < 0 || static_cast<size_t>(index) >= model.getNbPieces() ||
+            static_cast<size_t>(index) == model.getPieceActiveIndex()) {
+            return false;
+        }
+        model.setPieceActive(static_cast<size_t>(index));
+        return true;
+    }
+
+    case 'u':  // Annulation du dernier coup
+        return model.annuler();
+
+    case 'y':  // Rétablissement du coup annulé
+        return model.retablir();
+
+    default:
+        erreur(numero, string("commande inconnue '") + commande + "'");
+    }
+}
+
+BilanScript ScriptConsole::executer(istream& entree) {
+    BilanScript bilan = {0, 0, 0, false, 0, 0};
+    chrono::steady_clock::time_point debut = chrono::steady_clock::now();
+
+    // Le bilan rend compte de la partie : les messages du modèle se taisent pendant le script
+    ostream* messages = model.getSortieMessages();
+    model.setSortieMessages(nullptr);
+    try {
+        char commande;
+        while (entree >> commande) {
+            if (commande == '#') {
+                entree.ignore(numeric_limits<streamsize>::max(), '\n');
+                continue;
+            }
+
+            ++bilan.commandes;
+            if (executerCommande(commande, entree, bilan.commandes)) {
+                ++bilan.coupsJoues;
+                if (bilan.coupVictoire == 0 && model.isPartieGagnee()) {
+                    bilan.coupVictoire = bilan.commandes;
+                }
+            } else {
+                ++bilan.coupsRefuses;
+            }
+        }
+    }
+    catch (...) {
+        model.setSortieMessages(messages);
+        throw;
+    }
+    model.setSortieMessages(messages);
+
+    bilan.victoire = model.isPartieGagnee();
+    bilan.secondes = chrono::duration<double>(chrono::steady_clock::now() - debut).count();
+    return bilan;
+}
+
+void ScriptConsole::afficherBilan(ostream& sortie, const BilanScript& bilan) {
+    sortie << "=== Bilan du script ===" << endl;
+    sortie << "Commandes : " << bilan.commandes << " (" << bilan.coupsJoues << " jouées, "
+           << bilan.coupsRefuses << " refusées)" << endl;
+    sortie << "Victoire : ";
+    if (bilan.victoire) {
+        sortie << "oui";
+    } else {
+        sortie << "non";
+    }
+    if (bilan.coupVictoire != 0) {
+        sortie << " (atteinte à la commande " << bilan.coupVictoire << ")";
+    }
+    sortie << endl;
+    sortie << "Durée : " << bilan.secondes << " s";
+    if (bilan.secondes > 0) {
+        sortie << " (" << static_cast<unsigned long>(bilan.commandes / bilan.secondes) << " commandes/s)";
+    }
+    sortie << endl;
+}
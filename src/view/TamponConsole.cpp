@@ -0,0 +1,110 @@
+#include "view/TamponConsole.hpp"
+
+namespace {
+    // Écart maximal (en cases) franchi en réécrivant les cases inchangées
+    const int ECART_REECRIT = 4;
+
+    const char* codeCouleur(CouleurConsole couleur) {
+        switch (couleur) {
+        case CouleurConsole::ROUGE: return "\033[31m";
+        case CouleurConsole::VERT:  return "\033[32m";
+        case CouleurConsole::JAUNE: return "\033[33m";
+        default:                    return "\033[0m";
+        }
+    }
+
+    void deplacerCurseur(string& sortie, int x, int y) {
+        // Séquence CUP, lignes et colonnes numérotées à partir de 1
+        sortie += "\033[";
+        sortie += to_string(y + 1);
+        sortie += ';';
+        sortie += to_string(x + 1);
+        sortie += 'H';
+    }
+}
+
+TamponConsole::TamponConsole() : largeur(0), hauteur(0), complet(true) {}
+
+void TamponConsole::redimensionner(int l, int h) {
+    if (l == largeur && h == hauteur) {
+        return;
+    }
+    largeur = l;
+    hauteur = h;
+    courante.assign(largeur * hauteur, Cellule{' ', CouleurConsole::DEFAUT});
+    affichee = courante;
+    complet = true;
+}
+
+void TamponConsole::vider() {
+    for (Cellule& cellule : courante) {
+        cellule.glyphe = ' ';
+        cellule.couleur = CouleurConsole::DEFAUT;
+    }
+}
+
+void TamponConsole::ecrire(int x, int y, char glyphe, CouleurConsole couleur) {
+    if (x < 0 || x >= largeur || y < 0 || y >= hauteur) {
+        return;
+    }
+    Cellule& cellule = courante[y * largeur + x];
+    cellule.glyphe = glyphe;
+    cellule.couleur = couleur;
+}
+
+void TamponConsole::ecrireTexte(int x, int y, const string& texte, CouleurConsole couleur) {
+    for (size_t i = 0; i < texte.size(); ++i) {
+        ecrire(x + static_cast<int>(i), y, texte[i], couleur);
+    }
+}
+
+size_t TamponConsole::rendre(string& sortie) {
+    // Après un effacement, l'écran est vide : seules les cases non blanches sont à écrire
+    const Cellule vide = {' ', CouleurConsole::DEFAUT};
+    if (complet) {
+        sortie += "\033[0m\033[2J";
+    }
+
+    size_t reecrites = 0;
+    int curseurX = -1;
+    int curseurY = -1;
+    CouleurConsole active = CouleurConsole::DEFAUT;
+    auto ecrireCellule = [&](const Cellule& cellule) {
+        if (cellule.couleur != active) {
+            sortie += codeCouleur(cellule.couleur);
+            active = cellule.couleur;
+        }
+        sortie += cellule.glyphe;
+        ++curseurX;
+    };
+
+    for (int y = 0; y < hauteur; ++y) {
+        for (int x = 0; x < largeur; ++x) {
+            const Cellule& cellule = courante[y * largeur + x];
+            const Cellule& ecran = complet ? vide : affichee[y * largeur + x];
+            if (cellule == ecran) {
+                continue;
+            }
+
+            // Un petit écart sur la ligne coûte moins cher réécrit que sauté avec le curseur
+            if (y == curseurY && x > curseurX && x - curseurX <= ECART_REECRIT) {
+                while (curseurX < x) {
+                    ecrireCellule(courante[y * largeur + curseurX]);
+                }
+            } else if (x != curseurX || y != curseurY) {
+                deplacerCurseur(sortie, x, y);
+                curseurX = x;
+                curseurY = y;
+            }
+            ecrireCellule(cellule);
+            ++reecrites;
+        }
+    }
+
+    if (active != CouleurConsole::DEFAUT) {
+        sortie += codeCouleur(CouleurConsole::DEFAUT);
+    }
+    affichee = courante;
+    complet = false;
+    return reecrites;
+}
@@ -0,0 +1,62 @@
+#include "view/Timeline.hpp"
+#include <algorithm>
+
+void Timeline::start(const string& nom, float duree, Etape etape, Fin fin, float delai) {
+    cancel(nom);
+    Animation animation = { nom, delai, duree, 0, etape, fin };
+    animations.push_back(animation);
+    if (delai <= 0 && etape) {
+        etape(0);  // Premier état visible dès la prochaine frame
+    }
+}
+
+void Timeline::cancel(const string& nom) {
+    for (size_t i = 0; i < animations.size(); ++i) {
+        if (animations[i].nom == nom) {
+            animations.erase(animations.begin() + i);
+            return;
+        }
+    }
+}
+
+bool Timeline::isRunning(const string& nom) const {
+    for (const Animation& animation : animations) {
+        if (animation.nom == nom) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Timeline::advance(float dt) {
+    // Les fins sont appelées après la boucle : elles peuvent lancer d'autres animations
+    vector<Fin> finies;
+
+    for (size_t i = 0; i < animations.size();) {
+        Animation& animation = animations[i];
+        animation.ecoule += dt;
+
+        float t = animation.duree > 0 ? (animation.ecoule - animation.delai) / animation.duree : 1;
+        if (t < 0) {
+            ++i;
+            continue;  // Encore dans le délai
+        }
+        t = std::min(t, 1.0f);
+        if (animation.etape) {
+            animation.etape(t);
+        }
+
+        if (t >= 1) {
+            finies.push_back(animation.fin);
+            animations.erase(animations.begin() + i);
+        } else {
+            ++i;
+        }
+    }
+
+    for (const Fin& fin : finies) {
+        if (fin) {
+            fin();
+        }
+    }
+}